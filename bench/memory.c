@@ -0,0 +1,185 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Benchmark of vector memory reads and writes.
+ *
+ * For every type and vector width, a buffer is copied vector by vector
+ * with port_memory_read_*() and port_memory_write_*(), and with element-wise loops
+ * for comparison. Throughput is printed in bytes per cycle (bytes per nanosecond
+ * on targets without a time stamp counter).
+ */
+
+#include "port/memory/read.fun.h"
+#include "port/memory/write.fun.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h> // for __rdtsc()
+#  define TICKS_UNIT "cycle"
+#else
+#  include <time.h> // for clock_gettime()
+#  define TICKS_UNIT "ns"
+#endif
+
+
+#define BUFFER_SIZE (16 << 10) // fits into L1 data cache
+#define NUM_REPEATS 4096
+
+static unsigned long long
+ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;
+#endif
+}
+
+static double
+bytes_per_tick(
+        size_t num_bytes,
+        unsigned long long num_ticks)
+{
+    return (double)num_bytes * NUM_REPEATS / (double)(num_ticks ? num_ticks : 1);
+}
+
+#define DEFINE_BENCHMARK(type, vlen) \
+__attribute__((noinline))                                                               \
+static port_##type##_v##vlen##_t scalar_read_##type##_v##vlen(                          \
+        port_const_void_ptr_t memory, size_t offset)                                    \
+{                                                                                       \
+    port_##type##_v##vlen##_t value;                                                    \
+    for (size_t i = 0; i < vlen; i++)                                                   \
+        value.s[i] = ((const port_##type##_t*)memory + offset)[i];                      \
+    return value;                                                                       \
+}                                                                                       \
+                                                                                        \
+__attribute__((noinline))                                                               \
+static void scalar_write_##type##_v##vlen(                                              \
+        port_void_ptr_t memory, size_t offset, port_##type##_v##vlen##_t value)         \
+{                                                                                       \
+    for (size_t i = 0; i < vlen; i++)                                                   \
+        ((port_##type##_t*)memory + offset)[i] = value.s[i];                            \
+}                                                                                       \
+                                                                                        \
+static void benchmark_##type##_v##vlen(                                                 \
+        port_void_ptr_t dest, port_const_void_ptr_t src)                                \
+{                                                                                       \
+    const size_t num_elements = BUFFER_SIZE / sizeof(port_##type##_t) / vlen * vlen;    \
+    const size_t num_bytes = num_elements * sizeof(port_##type##_t);                    \
+                                                                                        \
+    unsigned long long start = ticks();                                                 \
+    for (int r = 0; r < NUM_REPEATS; r++)                                               \
+        for (size_t i = 0; i < num_elements; i += vlen)                                 \
+            scalar_write_##type##_v##vlen(dest, i, scalar_read_##type##_v##vlen(src, i)); \
+    double scalar = bytes_per_tick(num_bytes, ticks() - start);                         \
+                                                                                        \
+    if (memcmp(dest, src, num_bytes) != 0)                                              \
+        printf("MISMATCH: ");                                                           \
+    memset(dest, 0, num_bytes);                                                         \
+                                                                                        \
+    start = ticks();                                                                    \
+    for (int r = 0; r < NUM_REPEATS; r++)                                               \
+        for (size_t i = 0; i < num_elements; i += vlen)                                 \
+            port_memory_write_##type##_v##vlen(dest, i, port_memory_read_##type##_v##vlen(src, i)); \
+    double vector = bytes_per_tick(num_bytes, ticks() - start);                         \
+                                                                                        \
+    if (memcmp(dest, src, num_bytes) != 0)                                              \
+        printf("MISMATCH: ");                                                           \
+    memset(dest, 0, num_bytes);                                                         \
+                                                                                        \
+    printf("%-8s v%-2i %10.3f %10.3f %8.2fx\n", #type, vlen,                            \
+            scalar, vector, vector / scalar);                                           \
+}
+
+#define DEFINE_BENCHMARKS(type) \
+    DEFINE_BENCHMARK(type, 2) \
+    DEFINE_BENCHMARK(type, 3) \
+    DEFINE_BENCHMARK(type, 4) \
+    DEFINE_BENCHMARK(type, 8) \
+    DEFINE_BENCHMARK(type, 16)
+
+DEFINE_BENCHMARKS(uint8)
+DEFINE_BENCHMARKS(uint16)
+DEFINE_BENCHMARKS(uint32)
+DEFINE_BENCHMARKS(uint64)
+
+DEFINE_BENCHMARKS(sint8)
+DEFINE_BENCHMARKS(sint16)
+DEFINE_BENCHMARKS(sint32)
+DEFINE_BENCHMARKS(sint64)
+
+DEFINE_BENCHMARKS(float32)
+DEFINE_BENCHMARKS(float64)
+
+#undef DEFINE_BENCHMARKS
+#undef DEFINE_BENCHMARK
+
+int
+main(void)
+{
+    port_void_ptr_t src = aligned_alloc(64, BUFFER_SIZE);
+    port_void_ptr_t dest = aligned_alloc(64, BUFFER_SIZE);
+    if ((src == NULL) || (dest == NULL))
+    {
+        free(src);
+        free(dest);
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < BUFFER_SIZE; i++)
+        ((unsigned char*)src)[i] = (unsigned char)(i * 31 + 7);
+    memset(dest, 0, BUFFER_SIZE);
+
+    printf("type     vlen  scalar, B/" TICKS_UNIT "  vector, B/" TICKS_UNIT "  speedup\n");
+
+#define RUN_BENCHMARKS(type) \
+    benchmark_##type##_v2(dest, src); \
+    benchmark_##type##_v3(dest, src); \
+    benchmark_##type##_v4(dest, src); \
+    benchmark_##type##_v8(dest, src); \
+    benchmark_##type##_v16(dest, src);
+
+    RUN_BENCHMARKS(uint8)
+    RUN_BENCHMARKS(uint16)
+    RUN_BENCHMARKS(uint32)
+    RUN_BENCHMARKS(uint64)
+
+    RUN_BENCHMARKS(sint8)
+    RUN_BENCHMARKS(sint16)
+    RUN_BENCHMARKS(sint32)
+    RUN_BENCHMARKS(sint64)
+
+    RUN_BENCHMARKS(float32)
+    RUN_BENCHMARKS(float64)
+
+#undef RUN_BENCHMARKS
+
+    free(src);
+    free(dest);
+
+    return EXIT_SUCCESS;
+}
@@ -20,6 +20,7 @@ SLIB_NAME = f"lib{PROJECT_PREFIX}.a"
 LIB_NAME = f"lib{PROJECT_PREFIX}.so"
 EXEC_NAME = f"{PROJECT_PREFIX}"
 TESTS_NAME = f"{PROJECT_PREFIX}-tests"
+BENCH_NAME = f"{PROJECT_PREFIX}-bench"
 
 
 INCLUDE_DIR = "include"
@@ -29,6 +30,8 @@ TEST_DIR = "test"
 TEST_HEADER_FILE = "test.h"
 TEST_SOURCE_FILE = "test.c"
 
+BENCH_DIR = "bench"
+
 BUILD_DIR = "build"
 
 # }}}
@@ -95,6 +98,7 @@ else:
 
 BUILD_LIB = 'NO_LIB' not in os.environ          ### <<<<<<<<<<<<<<<<<<<< INPUT ENVIRONMENT VARIABLE <<<<<<<<<<<<<<<<<<<<
 BUILD_TESTS = 'NO_TESTS' not in os.environ      ### <<<<<<<<<<<<<<<<<<<< INPUT ENVIRONMENT VARIABLE <<<<<<<<<<<<<<<<<<<<
+BUILD_BENCH = 'BENCH' in os.environ             ### <<<<<<<<<<<<<<<<<<<< INPUT ENVIRONMENT VARIABLE <<<<<<<<<<<<<<<<<<<<
 
 # }}}
 # utility functions {{{
@@ -212,6 +216,20 @@ build tests: phony {BUILD_DIR}/{TESTS_NAME}
 ''')
     build_ninja_targets.append('tests')
 
+## }}}
+## benchmark executable {{{
+
+if BUILD_BENCH:
+    sources, objects = collect_sources(BENCH_DIR)
+
+    build_ninja_segments.append(f'''\
+{'\n'.join([f'build {obj}: compile {src}' for obj, src in zip(objects, sources)])}
+
+build {BUILD_DIR}/{BENCH_NAME}: link_exe {' '.join(objects)} {BUILD_DIR}/{SLIB_NAME}
+build bench: phony {BUILD_DIR}/{BENCH_NAME}
+''')
+    build_ninja_targets.append('bench')
+
 ## }}}
 ## targets {{{
 
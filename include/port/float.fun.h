@@ -320,6 +320,10 @@ port_float64_multi_product(
  *
  * Format of float16 is IEEE 754.
  *
+ * If PORT_FEATURE_FLOAT16_TABLE is defined, host code uses
+ * lookup tables instead of hardware conversion.
+ * Results of table conversion are exact, NaN payloads are preserved.
+ *
  * @return Single precision float.
  */
 port_float32_t
@@ -477,5 +481,40 @@ port_convert_float32_to_float16_v16(
 #define port_convert_float_single_to_float_half_v8 port_convert_float32_to_float16_v8
 #define port_convert_float_single_to_float_half_v16 port_convert_float32_to_float16_v16
 
+///////////////////////////////////////////////////////////////////////////////
+// Array conversions
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Convert array of half precision floating-point numbers to single precision.
+ *
+ * On x86 CPUs, AVX-512 or F16C conversion instructions are used if supported at run time.
+ * Results are the same as of port_convert_float16_to_float32(),
+ * except that signaling NaNs may be converted to quiet NaNs.
+ */
+void
+port_convert_float16_array_to_float32(
+        port_float32_t *dst, ///< [out] Single precision float values.
+        const port_uint16_t *src, ///< [in] Half precision float values.
+        size_t num_values ///< [in] Number of values.
+);
+
+/**
+ * @brief Convert array of single precision floating-point numbers to half precision.
+ *
+ * On x86 CPUs, AVX-512 or F16C conversion instructions are used if supported at run time.
+ * Results are the same as of port_convert_float32_to_float16(),
+ * except for mantissas of NaNs that are not representable in half precision.
+ */
+void
+port_convert_float32_array_to_float16(
+        port_uint16_t *dst, ///< [out] Half precision float values.
+        const port_float32_t *src, ///< [in] Single precision float values.
+        size_t num_values ///< [in] Number of values.
+);
+
+#define port_convert_float_half_array_to_float_single port_convert_float16_array_to_float32
+#define port_convert_float_single_array_to_float_half port_convert_float32_array_to_float16
+
 #endif // _PORT_FLOAT_FUN_H_
 
@@ -61,5 +61,21 @@
 
 #endif
 
+#ifdef PORT_FEATURE_INLINE
+
+/**
+ * @brief Storage class of functions defined in *.inl.h headers.
+ *
+ * In the inline mode, these functions are defined in every translation unit
+ * that includes the corresponding header, and can be inlined by the compiler.
+ */
+#  define PORT_INLINE static inline
+
+#else
+
+#  define PORT_INLINE
+
+#endif
+
 #endif // _PORT_KEYWORDS_DEF_H_
 
@@ -27,6 +27,12 @@
 #define _PORT_MEMORY_DEF_H_
 
 #include "port/bit.def.h"
+#include "port/memory.typ.h"
+#include "port/pointer.typ.h"
+
+#if defined(PORT_FEATURE_MEMORY_PROFILE) && !defined(__OPENCL_C_VERSION__)
+#  include "port/memory/profile.fun.h"
+#endif
 
 
 /**
@@ -94,5 +100,62 @@
      PORT_MEMORY_FAR_AT((ref), (far_num_tidx_bits), (far_offset_lshift), (memory_table)) : \
      PORT_MEMORY_NEAR_AT((ref), (near_offset_lshift), (base_ptr), (memory_table)[0]))
 
+///////////////////////////////////////////////////////////////////////////////
+// Compile-time reference formats
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Define functions for a memory reference format known at compile time.
+ *
+ * Defines the following static inline functions:
+ * - port_memory_format_<name>() returning the format as port_memory_ref_format_t;
+ * - port_memory_at_<name>() and its _local/_global/_constant variants,
+ *   which are the same as port_memory_at() with the format baked in.
+ *
+ * As the format is constant, shifts and masks can be folded by the compiler,
+ * and the format argument disappears from function (and kernel) signatures.
+ *
+ * If PORT_FEATURE_MEMORY_PROFILE is defined, resolutions in generic memory
+ * are recorded by the profiler, as with port_memory_at().
+ */
+#define PORT_MEMORY_DEFINE_FORMAT(name, far_num_tidx_bits, far_offset_lshift, near_offset_lshift) \
+    static inline port_memory_ref_format_t port_memory_format_##name(void) {                      \
+        port_memory_ref_format_t format = {                                                         \
+            .far = {(far_num_tidx_bits), (far_offset_lshift)}, .near = {(near_offset_lshift)}};     \
+        return format; }                                                                            \
+    PORT_MEMORY_DEFINE_FORMAT__AT(name, , port_const_void_ptr_t, port_const_char_ptr_t,            \
+            far_num_tidx_bits, far_offset_lshift, near_offset_lshift)                               \
+    PORT_MEMORY_DEFINE_FORMAT__AT(name, _local, port_const_local_void_ptr_t, port_const_local_char_ptr_t, \
+            far_num_tidx_bits, far_offset_lshift, near_offset_lshift)                               \
+    PORT_MEMORY_DEFINE_FORMAT__AT(name, _global, port_const_global_void_ptr_t, port_const_global_char_ptr_t, \
+            far_num_tidx_bits, far_offset_lshift, near_offset_lshift)                               \
+    PORT_MEMORY_DEFINE_FORMAT__AT(name, _constant, port_constant_void_ptr_t, port_constant_char_ptr_t, \
+            far_num_tidx_bits, far_offset_lshift, near_offset_lshift)
+
+/**
+ * @brief Define memory reference resolution function for a compile-time format and an address space.
+ *
+ * Used by PORT_MEMORY_DEFINE_FORMAT().
+ */
+#define PORT_MEMORY_DEFINE_FORMAT__AT(name, suffix, ptr_type, char_ptr_type,                       \
+        far_num_tidx_bits, far_offset_lshift, near_offset_lshift)                                   \
+    static inline ptr_type port_memory_at_##name##suffix(port_memory_ref_t ref,                    \
+            ptr_type base_ptr, const PORT_KW_CONSTANT ptr_type *memory_table) {                     \
+        return PORT_MEMORY_DEFINE_FORMAT__PROFILE(name, ref, ptr_type,                             \
+                PORT_MEMORY_AT(ref, (far_num_tidx_bits), (far_offset_lshift), (near_offset_lshift), \
+                    (char_ptr_type)base_ptr, (const PORT_KW_CONSTANT char_ptr_type*)memory_table)); }
+
+/**
+ * @brief Record resolution done by a function defined with PORT_MEMORY_DEFINE_FORMAT().
+ *
+ * Expands to the resolved pointer itself unless PORT_FEATURE_MEMORY_PROFILE is defined.
+ */
+#if defined(PORT_FEATURE_MEMORY_PROFILE) && !defined(__OPENCL_C_VERSION__)
+#  define PORT_MEMORY_DEFINE_FORMAT__PROFILE(name, ref, ptr_type, ptr) \
+    (ptr_type)port_memory_profile_record((ref), port_memory_format_##name(), (ptr))
+#else
+#  define PORT_MEMORY_DEFINE_FORMAT__PROFILE(name, ref, ptr_type, ptr) (ptr)
+#endif
+
 #endif // _PORT_MEMORY_DEF_H_
 
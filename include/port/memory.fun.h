@@ -27,8 +27,17 @@
 #define _PORT_MEMORY_FUN_H_
 
 #include "port/memory.typ.h"
+#include "port/memory/unit.typ.h"
 #include "port/pointer.typ.h"
 
+#ifndef __OPENCL_C_VERSION__
+#  include <stdbool.h>
+#endif
+
+#ifdef PORT_FEATURE_INLINE
+#  include "port/memory.inl.h" // static inline definitions
+#endif
+
 
 /**
  * @brief Follow memory reference in generic memory.
@@ -104,5 +113,749 @@ port_memory_at_constant(
 
 #endif // __OPENCL_C_VERSION__
 
+///////////////////////////////////////////////////////////////////////////////
+// Reference encoding
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Encode near memory reference.
+ *
+ * Near references point forward only, so offset must be positive.
+ *
+ * @return True on success, false if offset is not representable in the format.
+ */
+bool
+port_memory_ref_encode_near(
+        size_t offset, ///< [in] Byte offset of the target from the base address.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_memory_ref_t *ref ///< [out] Memory reference.
+);
+
+/**
+ * @brief Encode far memory reference.
+ *
+ * @return True on success, false if table index or offset is not representable in the format.
+ */
+bool
+port_memory_ref_encode_far(
+        port_uint32_t table_index, ///< [in] Index of the memory table entry.
+        size_t offset, ///< [in] Byte offset of the target from the table entry.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_memory_ref_t *ref ///< [out] Memory reference.
+);
+
+///////////////////////////////////////////////////////////////////////////////
+// Vectorized reference decoding
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Decode vector of memory references to table indices and byte offsets.
+ *
+ * For a far reference, table index and offset are extracted as by
+ * PORT_MEMORY_REF_FAR__TABLE_INDEX() and PORT_MEMORY_REF_FAR__OFFSET(),
+ * then the offset is scaled to bytes.
+ * For a near reference, table index is -1, and byte offset is relative to the base address.
+ * Byte offsets are computed modulo 2^32, offset shifts must be less than 32.
+ *
+ * Decoding is branchless, so it maps to SIMD instructions on CPU and to vector lanes on GPU.
+ *
+ * @return Vector of byte offsets.
+ */
+port_uint32_v4_t
+port_memory_ref_decode_v4(
+        port_sint32_v4_t refs, ///< [in] Memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_sint32_v4_t *tidx ///< [out] Table indices (-1 for near references).
+);
+
+/**
+ * @brief Decode vector of memory references to table indices and byte offsets.
+ *
+ * @see port_memory_ref_decode_v4()
+ *
+ * @return Vector of byte offsets.
+ */
+port_uint32_v8_t
+port_memory_ref_decode_v8(
+        port_sint32_v8_t refs, ///< [in] Memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_sint32_v8_t *tidx ///< [out] Table indices (-1 for near references).
+);
+
+/**
+ * @brief Decode vector of memory references to table indices and byte offsets.
+ *
+ * @see port_memory_ref_decode_v4()
+ *
+ * @return Vector of byte offsets.
+ */
+port_uint32_v16_t
+port_memory_ref_decode_v16(
+        port_sint32_v16_t refs, ///< [in] Memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_sint32_v16_t *tidx ///< [out] Table indices (-1 for near references).
+);
+
+///////////////////////////////////////////////////////////////////////////////
+// Half and quarter size references
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Follow half size memory reference in generic memory.
+ *
+ * Same as port_memory_at(), but for a reference of half size.
+ * Number of table index bits in the format must be less than 16.
+ *
+ * @see port_memory_at()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_const_void_ptr_t
+port_memory_at_half(
+        port_memory_ref_half_t ref, ///< [in] Memory reference (half size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow quarter size memory reference in generic memory.
+ *
+ * Same as port_memory_at(), but for a reference of quarter size.
+ * Number of table index bits in the format must be less than 8.
+ *
+ * @see port_memory_at()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_const_void_ptr_t
+port_memory_at_quarter(
+        port_memory_ref_quarter_t ref, ///< [in] Memory reference (quarter size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow all half size memory references packed in a unit in generic memory.
+ *
+ * References are accessed through PORT_MEMORY_UNIT__AS_REF_HALF.
+ * All near references use the same base address.
+ *
+ * @see port_memory_at_half()
+ */
+void
+port_memory_at_unit_half(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 2 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_void_ptr_t ptrs[2] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow all quarter size memory references packed in a unit in generic memory.
+ *
+ * References are accessed through PORT_MEMORY_UNIT__AS_REF_QUARTER.
+ * All near references use the same base address.
+ *
+ * @see port_memory_at_quarter()
+ */
+void
+port_memory_at_unit_quarter(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 4 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_void_ptr_t ptrs[4] ///< [out] Pointers to referenced memory.
+);
+
+#ifdef __OPENCL_C_VERSION__
+
+/**
+ * @brief Follow half size memory reference in local memory.
+ *
+ * @see port_memory_at_half()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_const_local_void_ptr_t
+port_memory_at_half_local(
+        port_memory_ref_half_t ref, ///< [in] Memory reference (half size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow quarter size memory reference in local memory.
+ *
+ * @see port_memory_at_quarter()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_const_local_void_ptr_t
+port_memory_at_quarter_local(
+        port_memory_ref_quarter_t ref, ///< [in] Memory reference (quarter size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow all half size memory references packed in a unit in local memory.
+ *
+ * @see port_memory_at_unit_half()
+ */
+void
+port_memory_at_unit_half_local(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 2 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_local_void_ptr_t ptrs[2] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow all quarter size memory references packed in a unit in local memory.
+ *
+ * @see port_memory_at_unit_quarter()
+ */
+void
+port_memory_at_unit_quarter_local(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 4 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_local_void_ptr_t ptrs[4] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow half size memory reference in global memory.
+ *
+ * @see port_memory_at_half()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_const_global_void_ptr_t
+port_memory_at_half_global(
+        port_memory_ref_half_t ref, ///< [in] Memory reference (half size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow quarter size memory reference in global memory.
+ *
+ * @see port_memory_at_quarter()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_const_global_void_ptr_t
+port_memory_at_quarter_global(
+        port_memory_ref_quarter_t ref, ///< [in] Memory reference (quarter size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow all half size memory references packed in a unit in global memory.
+ *
+ * @see port_memory_at_unit_half()
+ */
+void
+port_memory_at_unit_half_global(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 2 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_global_void_ptr_t ptrs[2] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow all quarter size memory references packed in a unit in global memory.
+ *
+ * @see port_memory_at_unit_quarter()
+ */
+void
+port_memory_at_unit_quarter_global(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 4 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_global_void_ptr_t ptrs[4] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow half size memory reference in constant memory.
+ *
+ * @see port_memory_at_half()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_constant_void_ptr_t
+port_memory_at_half_constant(
+        port_memory_ref_half_t ref, ///< [in] Memory reference (half size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow quarter size memory reference in constant memory.
+ *
+ * @see port_memory_at_quarter()
+ *
+ * @return Pointer to referenced memory.
+ */
+port_constant_void_ptr_t
+port_memory_at_quarter_constant(
+        port_memory_ref_quarter_t ref, ///< [in] Memory reference (quarter size).
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Follow all half size memory references packed in a unit in constant memory.
+ *
+ * @see port_memory_at_unit_half()
+ */
+void
+port_memory_at_unit_half_constant(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 2 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_constant_void_ptr_t ptrs[2] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow all quarter size memory references packed in a unit in constant memory.
+ *
+ * @see port_memory_at_unit_quarter()
+ */
+void
+port_memory_at_unit_quarter_constant(
+        port_memory_unit_t unit, ///< [in] Memory unit containing 4 packed references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_constant_void_ptr_t ptrs[4] ///< [out] Pointers to referenced memory.
+);
+
+#else // __OPENCL_C_VERSION__
+
+#  define port_memory_at_half_local               port_memory_at_half
+#  define port_memory_at_half_global              port_memory_at_half
+#  define port_memory_at_half_constant            port_memory_at_half
+
+#  define port_memory_at_quarter_local            port_memory_at_quarter
+#  define port_memory_at_quarter_global           port_memory_at_quarter
+#  define port_memory_at_quarter_constant         port_memory_at_quarter
+
+#  define port_memory_at_unit_half_local          port_memory_at_unit_half
+#  define port_memory_at_unit_half_global         port_memory_at_unit_half
+#  define port_memory_at_unit_half_constant       port_memory_at_unit_half
+
+#  define port_memory_at_unit_quarter_local       port_memory_at_unit_quarter
+#  define port_memory_at_unit_quarter_global      port_memory_at_unit_quarter
+#  define port_memory_at_unit_quarter_constant    port_memory_at_unit_quarter
+
+#endif // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Batched reference resolution
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Follow array of memory references in generic memory.
+ *
+ * Result is the same as calling port_memory_at() for every reference,
+ * but the format is decoded once, and near/far selection is branchless.
+ * On CPU with AVX2, references are resolved 4 at a time using a gather over the memory table.
+ *
+ * @see port_memory_at()
+ */
+void
+port_memory_at_batch(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_void_ptr_t ptrs[] ///< [out] Pointers to referenced memory.
+);
+
+#ifdef __OPENCL_C_VERSION__
+
+/**
+ * @brief Follow array of memory references in local memory.
+ *
+ * @see port_memory_at_batch()
+ */
+void
+port_memory_at_batch_local(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_local_void_ptr_t ptrs[] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow array of memory references in global memory.
+ *
+ * @see port_memory_at_batch()
+ */
+void
+port_memory_at_batch_global(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_const_global_void_ptr_t ptrs[] ///< [out] Pointers to referenced memory.
+);
+
+/**
+ * @brief Follow array of memory references in constant memory.
+ *
+ * @see port_memory_at_batch()
+ */
+void
+port_memory_at_batch_constant(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_constant_void_ptr_t ptrs[] ///< [out] Pointers to referenced memory.
+);
+
+#else // __OPENCL_C_VERSION__
+
+#  define port_memory_at_batch_local    port_memory_at_batch
+#  define port_memory_at_batch_global   port_memory_at_batch
+#  define port_memory_at_batch_constant port_memory_at_batch
+
+#endif // __OPENCL_C_VERSION__
+
+/**
+ * @brief Resolve array of memory references to byte offsets.
+ *
+ * This is port_memory_at_batch() in the offset space:
+ * memory table contains byte offsets of memory segments instead of pointers,
+ * base offset replaces base pointer, and resulting byte offsets replace pointers.
+ * This is useful when all segments reside in a single buffer (e.g. OpenCL buffer),
+ * so offsets can be stored and processed in place of pointers.
+ *
+ * Unlike port_memory_at_batch(), there is no fallback for the base:
+ * pass offset_table[0] as base offset to get the same behavior as for NULL base pointer.
+ */
+void
+port_memory_offset_batch(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        size_t base_offset, ///< [in] Base byte offset for near memory references.
+        const PORT_KW_CONSTANT size_t *offset_table, ///< [in] Table of byte offsets for far memory references.
+
+        size_t offsets[] ///< [out] Byte offsets of referenced memory.
+);
+
+///////////////////////////////////////////////////////////////////////////////
+// Prefetching
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Prefetch memory referenced in generic memory.
+ *
+ * Resolves the reference and hints the processor to bring the target into cache,
+ * so that the latency of a later access overlaps with other work.
+ * On CPU, __builtin_prefetch() is used if available.
+ * In OpenCL, prefetch() is used for global memory, other address spaces compile to nothing.
+ *
+ * @see port_memory_at()
+ */
+void
+port_memory_prefetch(
+        port_memory_ref_t ref, ///< [in] Memory reference.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+#ifdef __OPENCL_C_VERSION__
+
+/**
+ * @brief Prefetch memory referenced in local memory.
+ *
+ * @see port_memory_prefetch()
+ */
+void
+port_memory_prefetch_local(
+        port_memory_ref_t ref, ///< [in] Memory reference.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Prefetch memory referenced in global memory.
+ *
+ * @see port_memory_prefetch()
+ */
+void
+port_memory_prefetch_global(
+        port_memory_ref_t ref, ///< [in] Memory reference.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+/**
+ * @brief Prefetch memory referenced in constant memory.
+ *
+ * @see port_memory_prefetch()
+ */
+void
+port_memory_prefetch_constant(
+        port_memory_ref_t ref, ///< [in] Memory reference.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory reference.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory reference.
+);
+
+#else // __OPENCL_C_VERSION__
+
+#  define port_memory_prefetch_local          port_memory_prefetch
+#  define port_memory_prefetch_global         port_memory_prefetch
+#  define port_memory_prefetch_constant       port_memory_prefetch
+
+#endif // __OPENCL_C_VERSION__
+
+/**
+ * @brief Prefetch memory referenced by an array of references in generic memory.
+ *
+ * Every reference is resolved once, and its target is prefetched.
+ * Near references are relative to base_ptr (or memory_table[0] if base_ptr is NULL).
+ *
+ * Prefetches are independent of each other, so their latencies overlap.
+ * This is useful for the next N targets of a traversal known in advance,
+ * for example all children of a tree node, or next nodes of several chains.
+ *
+ * @see port_memory_prefetch()
+ */
+void
+port_memory_prefetch_batch(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory references.
+);
+
+#ifdef __OPENCL_C_VERSION__
+
+/**
+ * @brief Prefetch memory referenced by an array of references in local memory.
+ *
+ * @see port_memory_prefetch_batch()
+ */
+void
+port_memory_prefetch_batch_local(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory references.
+);
+
+/**
+ * @brief Prefetch memory referenced by an array of references in global memory.
+ *
+ * @see port_memory_prefetch_batch()
+ */
+void
+port_memory_prefetch_batch_global(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory references.
+);
+
+/**
+ * @brief Prefetch memory referenced by an array of references in constant memory.
+ *
+ * @see port_memory_prefetch_batch()
+ */
+void
+port_memory_prefetch_batch_constant(
+        const port_memory_ref_t refs[], ///< [in] Memory references.
+        size_t num_refs, ///< [in] Number of memory references.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory references.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table ///< [in] Table of memory pointers for far memory references.
+);
+
+#else // __OPENCL_C_VERSION__
+
+#  define port_memory_prefetch_batch_local    port_memory_prefetch_batch
+#  define port_memory_prefetch_batch_global   port_memory_prefetch_batch
+#  define port_memory_prefetch_batch_constant port_memory_prefetch_batch
+
+#endif // __OPENCL_C_VERSION__
+
+/**
+ * @brief Follow chain of memory references in generic memory.
+ *
+ * A node is an array of memory units, one of which (link_idx) contains
+ * a memory reference to the next node. Near reference to the next node
+ * is relative to the current node.
+ *
+ * Every step depends on the load of the previous node, so a single chain
+ * cannot be sped up by prefetching. To overlap memory latencies,
+ * prefetch targets known in advance with port_memory_prefetch_batch().
+ *
+ * @return Pointer to the last node of the chain.
+ */
+port_const_void_ptr_t
+port_memory_follow_chain(
+        port_memory_ref_t ref, ///< [in] Memory reference to the first node.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near memory reference to the first node.
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        size_t link_idx, ///< [in] Index of node unit containing reference to the next node.
+        size_t num_steps, ///< [in] Number of links to follow.
+
+        port_const_void_ptr_t nodes[] ///< [out] Pointers to num_steps+1 visited nodes, or NULL.
+);
+
+#ifdef __OPENCL_C_VERSION__
+
+/**
+ * @brief Follow chain of memory references in local memory.
+ *
+ * @see port_memory_follow_chain()
+ *
+ * @return Pointer to the last node of the chain.
+ */
+port_const_local_void_ptr_t
+port_memory_follow_chain_local(
+        port_memory_ref_t ref, ///< [in] Memory reference to the first node.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_local_void_ptr_t base_ptr, ///< [in] Base address for near memory reference to the first node.
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        size_t link_idx, ///< [in] Index of node unit containing reference to the next node.
+        size_t num_steps, ///< [in] Number of links to follow.
+
+        port_const_local_void_ptr_t nodes[] ///< [out] Pointers to num_steps+1 visited nodes, or NULL.
+);
+
+/**
+ * @brief Follow chain of memory references in global memory.
+ *
+ * @see port_memory_follow_chain()
+ *
+ * @return Pointer to the last node of the chain.
+ */
+port_const_global_void_ptr_t
+port_memory_follow_chain_global(
+        port_memory_ref_t ref, ///< [in] Memory reference to the first node.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_const_global_void_ptr_t base_ptr, ///< [in] Base address for near memory reference to the first node.
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        size_t link_idx, ///< [in] Index of node unit containing reference to the next node.
+        size_t num_steps, ///< [in] Number of links to follow.
+
+        port_const_global_void_ptr_t nodes[] ///< [out] Pointers to num_steps+1 visited nodes, or NULL.
+);
+
+/**
+ * @brief Follow chain of memory references in constant memory.
+ *
+ * @see port_memory_follow_chain()
+ *
+ * @return Pointer to the last node of the chain.
+ */
+port_constant_void_ptr_t
+port_memory_follow_chain_constant(
+        port_memory_ref_t ref, ///< [in] Memory reference to the first node.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_constant_void_ptr_t base_ptr, ///< [in] Base address for near memory reference to the first node.
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        size_t link_idx, ///< [in] Index of node unit containing reference to the next node.
+        size_t num_steps, ///< [in] Number of links to follow.
+
+        port_constant_void_ptr_t nodes[] ///< [out] Pointers to num_steps+1 visited nodes, or NULL.
+);
+
+#else // __OPENCL_C_VERSION__
+
+#  define port_memory_follow_chain_local          port_memory_follow_chain
+#  define port_memory_follow_chain_global         port_memory_follow_chain
+#  define port_memory_follow_chain_constant       port_memory_follow_chain
+
+#endif // __OPENCL_C_VERSION__
+
 #endif // _PORT_MEMORY_FUN_H_
 
@@ -0,0 +1,294 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Definitions of functions for following memory references.
+ *
+ * Definitions are compiled into the library by default.
+ * If PORT_FEATURE_INLINE is defined, they are included by the corresponding
+ * .fun.h header as static inline functions instead.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_INL_H_
+#define _PORT_MEMORY_INL_H_
+
+#include "port/memory.typ.h"
+#include "port/memory/unit.typ.h"
+#include "port/memory.def.h"
+#include "port/pointer.typ.h"
+
+#ifndef __OPENCL_C_VERSION__
+#  include <stdbool.h>
+#  include <assert.h>
+#endif
+
+#if defined(PORT_FEATURE_MEMORY_PROFILE) && !defined(__OPENCL_C_VERSION__)
+#  include "port/memory/profile.fun.h"
+#endif
+
+
+#if defined(PORT_FEATURE_MEMORY_PROFILE) && !defined(__OPENCL_C_VERSION__)
+#  define PROFILE(ref, ptr) port_memory_profile_record((ref), format, (ptr))
+#else
+#  define PROFILE(ref, ptr) (ptr)
+#endif
+
+#if !defined(__OPENCL_C_VERSION__) && !defined(NDEBUG)
+
+#  define ASSERTS(ref_type) \
+    assert(format.far.num_tidx_bits < PORT_NUM_BITS(ref_type)); \
+    if (PORT_MEMORY_REF_IS_FAR(ref)) { \
+        size_t offset = PORT_MEMORY_REF_FAR__OFFSET(ref, format.far.num_tidx_bits); \
+        assert(((offset << format.far.offset_lshift) >> format.far.offset_lshift) == offset); \
+    } else { \
+        size_t offset = -(size_t)ref; \
+        assert(((offset << format.near.offset_lshift) >> format.near.offset_lshift) == offset); \
+    } \
+    assert(memory_table != NULL);
+
+#else
+
+#  define ASSERTS(ref_type)
+
+#endif
+
+PORT_INLINE port_const_void_ptr_t
+port_memory_at(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_const_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table)
+{
+    ASSERTS(port_memory_ref_t);
+    return PROFILE(ref, PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
+            (port_const_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_const_char_ptr_t*)memory_table));
+}
+
+#ifdef __OPENCL_C_VERSION__
+
+PORT_INLINE port_const_local_void_ptr_t
+port_memory_at_local(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_const_local_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table)
+{
+    ASSERTS(port_memory_ref_t);
+    return PROFILE(ref, PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
+            (port_const_local_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_const_local_char_ptr_t*)memory_table));
+}
+
+PORT_INLINE port_const_global_void_ptr_t
+port_memory_at_global(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_const_global_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table)
+{
+    ASSERTS(port_memory_ref_t);
+    return PROFILE(ref, PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
+            (port_const_global_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_const_global_char_ptr_t*)memory_table));
+}
+
+PORT_INLINE port_constant_void_ptr_t
+port_memory_at_constant(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_constant_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table)
+{
+    ASSERTS(port_memory_ref_t);
+    return PROFILE(ref, PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
+            (port_constant_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_constant_char_ptr_t*)memory_table));
+}
+
+#endif // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Vectorized reference decoding
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_DECODE_FUNCTION(vlen) \
+PORT_INLINE port_uint32_v##vlen##_t port_memory_ref_decode_v##vlen( \
+        port_sint32_v##vlen##_t refs, port_memory_ref_format_t format, port_sint32_v##vlen##_t *tidx) \
+{                                                                                               \
+    port_sint32_v##vlen##_t far = refs >= 0;                                                   \
+    port_uint32_v##vlen##_t value = as_uint##vlen(refs);                                        \
+                                                                                                \
+    *tidx = select((port_sint32_v##vlen##_t)(-1),                                              \
+            as_int##vlen(value & PORT_SINGLE_ZMASK(format.far.num_tidx_bits)), far);            \
+                                                                                                \
+    return select((0 - value) << format.near.offset_lshift,                                     \
+            (value >> format.far.num_tidx_bits) << format.far.offset_lshift, far);              \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_DECODE_FUNCTION(vlen) \
+PORT_INLINE port_uint32_v##vlen##_t port_memory_ref_decode_v##vlen( \
+        port_sint32_v##vlen##_t refs, port_memory_ref_format_t format, port_sint32_v##vlen##_t *tidx) \
+{                                                                                               \
+    port_uint32_v##vlen##_t offsets;                                                            \
+    for (int i = 0; i < vlen; i++)                                                              \
+    {                                                                                           \
+        port_uint32_t value = refs.s[i];                                                        \
+        bool far = PORT_MEMORY_REF_IS_FAR(refs.s[i]);                                           \
+                                                                                                \
+        tidx->s[i] = far ? (port_sint32_t)(value & PORT_SINGLE_ZMASK(format.far.num_tidx_bits)) : -1; \
+        offsets.s[i] = far ? (value >> format.far.num_tidx_bits) << format.far.offset_lshift :  \
+            (0 - value) << format.near.offset_lshift;                                           \
+    }                                                                                           \
+    return offsets;                                                                             \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+DEFINE_DECODE_FUNCTION(4)
+DEFINE_DECODE_FUNCTION(8)
+DEFINE_DECODE_FUNCTION(16)
+
+#undef DEFINE_DECODE_FUNCTION
+
+///////////////////////////////////////////////////////////////////////////////
+// Half and quarter size references
+///////////////////////////////////////////////////////////////////////////////
+
+#define DEFINE_AT_FUNCTIONS(suffix, ptr_type, char_ptr_type) \
+PORT_INLINE ptr_type port_memory_at_half##suffix(port_memory_ref_half_t ref, port_memory_ref_format_t format, \
+        ptr_type base_ptr, const PORT_KW_CONSTANT ptr_type *memory_table) \
+{                                                                                               \
+    ASSERTS(port_memory_ref_half_t);                                                            \
+    return PROFILE(ref, PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift, \
+            (char_ptr_type)base_ptr, (const PORT_KW_CONSTANT char_ptr_type*)memory_table));     \
+}                                                                                               \
+PORT_INLINE ptr_type port_memory_at_quarter##suffix(port_memory_ref_quarter_t ref, port_memory_ref_format_t format, \
+        ptr_type base_ptr, const PORT_KW_CONSTANT ptr_type *memory_table) \
+{                                                                                               \
+    ASSERTS(port_memory_ref_quarter_t);                                                         \
+    return PROFILE(ref, PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift, \
+            (char_ptr_type)base_ptr, (const PORT_KW_CONSTANT char_ptr_type*)memory_table));     \
+}                                                                                               \
+PORT_INLINE void port_memory_at_unit_half##suffix(port_memory_unit_t unit, port_memory_ref_format_t format, \
+        ptr_type base_ptr, const PORT_KW_CONSTANT ptr_type *memory_table, ptr_type ptrs[2]) \
+{                                                                                               \
+    for (int i = 0; i < 2; i++)                                                                 \
+        ptrs[i] = port_memory_at_half##suffix(unit.PORT_MEMORY_UNIT__AS_REF_HALF[i],           \
+                format, base_ptr, memory_table);                                                \
+}                                                                                               \
+PORT_INLINE void port_memory_at_unit_quarter##suffix(port_memory_unit_t unit, port_memory_ref_format_t format, \
+        ptr_type base_ptr, const PORT_KW_CONSTANT ptr_type *memory_table, ptr_type ptrs[4]) \
+{                                                                                               \
+    for (int i = 0; i < 4; i++)                                                                 \
+        ptrs[i] = port_memory_at_quarter##suffix(unit.PORT_MEMORY_UNIT__AS_REF_QUARTER[i],     \
+                format, base_ptr, memory_table);                                                \
+}
+
+DEFINE_AT_FUNCTIONS(, port_const_void_ptr_t, port_const_char_ptr_t)
+
+#ifdef __OPENCL_C_VERSION__
+
+DEFINE_AT_FUNCTIONS(_local, port_const_local_void_ptr_t, port_const_local_char_ptr_t)
+DEFINE_AT_FUNCTIONS(_global, port_const_global_void_ptr_t, port_const_global_char_ptr_t)
+DEFINE_AT_FUNCTIONS(_constant, port_constant_void_ptr_t, port_constant_char_ptr_t)
+
+#endif // __OPENCL_C_VERSION__
+
+#undef DEFINE_AT_FUNCTIONS
+
+///////////////////////////////////////////////////////////////////////////////
+// Prefetching
+///////////////////////////////////////////////////////////////////////////////
+
+PORT_INLINE void
+port_memory_prefetch(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_const_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table)
+{
+#if defined(__GNUC__) && !defined(__OPENCL_C_VERSION__)
+    // not port_memory_at(), prefetches are not resolutions to be profiled
+    __builtin_prefetch(PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
+                (port_const_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_const_char_ptr_t*)memory_table));
+#else
+    (void) ref;
+    (void) format;
+    (void) base_ptr;
+    (void) memory_table;
+#endif
+}
+
+#ifdef __OPENCL_C_VERSION__
+
+PORT_INLINE void
+port_memory_prefetch_local(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_const_local_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table)
+{
+    (void) ref;
+    (void) format;
+    (void) base_ptr;
+    (void) memory_table;
+}
+
+PORT_INLINE void
+port_memory_prefetch_global(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_const_global_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table)
+{
+    prefetch((const __global port_uint_single_t*)PORT_MEMORY_AT(ref, format.far.num_tidx_bits,
+                format.far.offset_lshift, format.near.offset_lshift, (port_const_global_char_ptr_t)base_ptr,
+                (const PORT_KW_CONSTANT port_const_global_char_ptr_t*)memory_table), 1);
+}
+
+PORT_INLINE void
+port_memory_prefetch_constant(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+
+        port_constant_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table)
+{
+    (void) ref;
+    (void) format;
+    (void) base_ptr;
+    (void) memory_table;
+}
+
+#endif // __OPENCL_C_VERSION__
+
+#undef ASSERTS
+#undef PROFILE
+
+#endif // _PORT_MEMORY_INL_H_
@@ -27,6 +27,7 @@
 #define _PORT_MEMORY_TYP_H_
 
 #include "port/types.typ.h"
+#include "port/pointer.typ.h"
 
 
 /**
@@ -56,5 +57,39 @@ typedef struct port_memory_ref_format {
     } near; ///< Format of near memory references.
 } port_memory_ref_format_t;
 
+/**
+ * @brief Map of memory references in a node.
+ *
+ * A node is an array of memory units,
+ * some of which contain memory references (single size).
+ */
+typedef struct port_memory_ref_map {
+    port_uint32_t num_units; ///< Number of units in the node.
+    port_uint32_t num_refs; ///< Number of units containing memory references.
+    const port_uint32_t *ref_units; ///< Indices of units containing memory references.
+} port_memory_ref_map_t;
+
+/**
+ * @brief Remapping of memory references of a copied block.
+ *
+ * Near references are relative to the node containing them,
+ * as in port_memory_relocate() and port_memory_follow_chain().
+ *
+ * Far references into the source block are rebased to the destination block.
+ * Other far references keep their offsets, and their table indices are remapped.
+ * Near references into the source block keep their values, as nodes keep their relative positions.
+ * Near references out of the block are converted to far references into the source segment,
+ * and their table indices are remapped.
+ */
+typedef struct port_memory_ref_remap {
+    port_uint32_t src_tidx; ///< Table index of the source segment.
+    port_uint32_t dest_tidx; ///< Table index of the destination segment.
+
+    size_t src_offset; ///< Offset of the source block in its segment in bytes.
+    size_t dest_offset; ///< Offset of the destination block in its segment in bytes.
+
+    const port_uint32_t *tidx_map; ///< Table index map (1 << num_tidx_bits elements), or NULL for identity.
+} port_memory_ref_remap_t;
+
 #endif // _PORT_MEMORY_TYP_H_
 
@@ -0,0 +1,104 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Unit arena allocation.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_ARENA_FUN_H_
+#define _PORT_MEMORY_ARENA_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/arena.typ.h"
+#include "port/pointer.typ.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Initialize empty arena.
+ */
+void
+port_memory_arena_init(
+        port_memory_arena_t *arena, ///< [out] Arena.
+        port_memory_ref_format_t format ///< [in] Memory reference format.
+);
+
+/**
+ * @brief Release resources of arena.
+ *
+ * Segment memory is not freed.
+ */
+void
+port_memory_arena_fini(
+        port_memory_arena_t *arena ///< [in] Arena.
+);
+
+/**
+ * @brief Add segment to arena.
+ *
+ * Segment memory is expected to be registered in the memory table at the given index.
+ *
+ * @return True on success, false on failure.
+ */
+bool
+port_memory_arena_add_segment(
+        port_memory_arena_t *arena, ///< [in,out] Arena.
+        port_void_ptr_t memory, ///< [in] Segment memory.
+        size_t num_bytes, ///< [in] Segment size in bytes.
+        port_uint32_t tidx ///< [in] Memory table index of the segment.
+);
+
+/**
+ * @brief Allocate block of units from arena.
+ *
+ * Block is placed right after the previous one if its near reference relative to base_ptr
+ * can be encoded, otherwise it is aligned to the far offset scale and referenced with a far reference.
+ * Near references are produced only if base_ptr is in the same segment as the block,
+ * so that segments can be stored and loaded separately.
+ * If the current segment cannot fit the block, the following segments are tried.
+ * NULL base_ptr means that only far references are produced.
+ *
+ * Allocated memory is not initialized.
+ *
+ * @return Pointer to allocated block, or NULL if arena is exhausted.
+ */
+port_void_ptr_t
+port_memory_arena_alloc(
+        port_memory_arena_t *arena, ///< [in,out] Arena.
+        size_t num_units, ///< [in] Number of units to allocate.
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near reference, or NULL.
+
+        port_memory_ref_t *ref ///< [out] Reference to the allocated block, or NULL.
+);
+
+/**
+ * @brief Free all blocks allocated from arena.
+ */
+void
+port_memory_arena_reset(
+        port_memory_arena_t *arena ///< [in,out] Arena.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_ARENA_FUN_H_
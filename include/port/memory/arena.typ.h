@@ -0,0 +1,62 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for unit arena allocation.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_ARENA_TYP_H_
+#define _PORT_MEMORY_ARENA_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.typ.h"
+#include "port/memory/unit.typ.h"
+
+
+/**
+ * @brief Arena segment.
+ */
+typedef struct port_memory_arena_segment {
+    port_memory_unit_t *memory; ///< Segment memory.
+    size_t num_units; ///< Segment size in units.
+    size_t num_used_units; ///< Number of allocated units.
+    port_uint32_t tidx; ///< Memory table index of the segment.
+} port_memory_arena_segment_t;
+
+/**
+ * @brief Unit arena.
+ *
+ * Allocates blocks of units from segments one after another.
+ */
+typedef struct port_memory_arena {
+    port_memory_ref_format_t format; ///< Memory reference format.
+
+    port_memory_arena_segment_t *segments; ///< Segments.
+    port_uint32_t num_segments; ///< Number of segments.
+    port_uint32_t capacity; ///< Capacity of segment array.
+
+    port_uint32_t current; ///< Index of the current segment.
+} port_memory_arena_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_ARENA_TYP_H_
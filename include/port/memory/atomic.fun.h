@@ -0,0 +1,257 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Atomic operations on memory units.
+ *
+ * Functions for generic address space map to C11 atomics and are available on CPU only.
+ * Functions for local and global address spaces map to OpenCL atomic built-ins;
+ * operations on double size units require cl_khr_int64_base_atomics and cl_khr_int64_extended_atomics.
+ * On CPU, names of local and global functions are aliases of generic functions,
+ * so that the same code compiles for both targets.
+ *
+ * load, store, exchange and compare-and-swap have their usual semantics.
+ * fetch_add, fetch_or, min and max return the value stored in the unit before the operation.
+ * On CPU, all operations are sequentially consistent;
+ * OpenCL atomic built-ins are relaxed and must be combined with memory fences when necessary.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_ATOMIC_FUN_H_
+#define _PORT_MEMORY_ATOMIC_FUN_H_
+
+#include "port/memory/unit.typ.h"
+
+#ifndef __OPENCL_C_VERSION__
+#  include <stdbool.h>
+#endif
+
+#ifdef PORT_FEATURE_INLINE
+#  include "port/memory/atomic.inl.h" // static inline definitions
+#endif
+
+#ifndef __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Atomic operations (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+// Unsigned integer (single size)
+port_uint_single_t port_memory_atomic_load_uint_single(const port_memory_unit_t *unit);
+void port_memory_atomic_store_uint_single(port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_exchange_uint_single(port_memory_unit_t *unit, port_uint_single_t value);
+bool port_memory_atomic_cas_uint_single(port_memory_unit_t *unit, port_uint_single_t *expected, port_uint_single_t desired);
+port_uint_single_t port_memory_atomic_fetch_add_uint_single(port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_fetch_or_uint_single(port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_min_uint_single(port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_max_uint_single(port_memory_unit_t *unit, port_uint_single_t value);
+
+// Signed integer (single size)
+port_sint_single_t port_memory_atomic_load_sint_single(const port_memory_unit_t *unit);
+void port_memory_atomic_store_sint_single(port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_exchange_sint_single(port_memory_unit_t *unit, port_sint_single_t value);
+bool port_memory_atomic_cas_sint_single(port_memory_unit_t *unit, port_sint_single_t *expected, port_sint_single_t desired);
+port_sint_single_t port_memory_atomic_fetch_add_sint_single(port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_fetch_or_sint_single(port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_min_sint_single(port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_max_sint_single(port_memory_unit_t *unit, port_sint_single_t value);
+
+// Unsigned integer (double size)
+port_uint_double_t port_memory_atomic_load_uint_double(const port_memory_unit_double_t *unit);
+void port_memory_atomic_store_uint_double(port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_exchange_uint_double(port_memory_unit_double_t *unit, port_uint_double_t value);
+bool port_memory_atomic_cas_uint_double(port_memory_unit_double_t *unit, port_uint_double_t *expected, port_uint_double_t desired);
+port_uint_double_t port_memory_atomic_fetch_add_uint_double(port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_fetch_or_uint_double(port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_min_uint_double(port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_max_uint_double(port_memory_unit_double_t *unit, port_uint_double_t value);
+
+// Signed integer (double size)
+port_sint_double_t port_memory_atomic_load_sint_double(const port_memory_unit_double_t *unit);
+void port_memory_atomic_store_sint_double(port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_exchange_sint_double(port_memory_unit_double_t *unit, port_sint_double_t value);
+bool port_memory_atomic_cas_sint_double(port_memory_unit_double_t *unit, port_sint_double_t *expected, port_sint_double_t desired);
+port_sint_double_t port_memory_atomic_fetch_add_sint_double(port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_fetch_or_sint_double(port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_min_sint_double(port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_max_sint_double(port_memory_unit_double_t *unit, port_sint_double_t value);
+
+///////////////////////////////////////////////////////////////////////////////
+// Aliases for named address spaces
+///////////////////////////////////////////////////////////////////////////////
+
+// Unsigned integer (single size)
+#  define port_memory_atomic_load_local_uint_single          port_memory_atomic_load_uint_single
+#  define port_memory_atomic_load_global_uint_single         port_memory_atomic_load_uint_single
+#  define port_memory_atomic_store_local_uint_single         port_memory_atomic_store_uint_single
+#  define port_memory_atomic_store_global_uint_single        port_memory_atomic_store_uint_single
+#  define port_memory_atomic_exchange_local_uint_single      port_memory_atomic_exchange_uint_single
+#  define port_memory_atomic_exchange_global_uint_single     port_memory_atomic_exchange_uint_single
+#  define port_memory_atomic_cas_local_uint_single           port_memory_atomic_cas_uint_single
+#  define port_memory_atomic_cas_global_uint_single          port_memory_atomic_cas_uint_single
+#  define port_memory_atomic_fetch_add_local_uint_single     port_memory_atomic_fetch_add_uint_single
+#  define port_memory_atomic_fetch_add_global_uint_single    port_memory_atomic_fetch_add_uint_single
+#  define port_memory_atomic_fetch_or_local_uint_single      port_memory_atomic_fetch_or_uint_single
+#  define port_memory_atomic_fetch_or_global_uint_single     port_memory_atomic_fetch_or_uint_single
+#  define port_memory_atomic_min_local_uint_single           port_memory_atomic_min_uint_single
+#  define port_memory_atomic_min_global_uint_single          port_memory_atomic_min_uint_single
+#  define port_memory_atomic_max_local_uint_single           port_memory_atomic_max_uint_single
+#  define port_memory_atomic_max_global_uint_single          port_memory_atomic_max_uint_single
+
+// Signed integer (single size)
+#  define port_memory_atomic_load_local_sint_single          port_memory_atomic_load_sint_single
+#  define port_memory_atomic_load_global_sint_single         port_memory_atomic_load_sint_single
+#  define port_memory_atomic_store_local_sint_single         port_memory_atomic_store_sint_single
+#  define port_memory_atomic_store_global_sint_single        port_memory_atomic_store_sint_single
+#  define port_memory_atomic_exchange_local_sint_single      port_memory_atomic_exchange_sint_single
+#  define port_memory_atomic_exchange_global_sint_single     port_memory_atomic_exchange_sint_single
+#  define port_memory_atomic_cas_local_sint_single           port_memory_atomic_cas_sint_single
+#  define port_memory_atomic_cas_global_sint_single          port_memory_atomic_cas_sint_single
+#  define port_memory_atomic_fetch_add_local_sint_single     port_memory_atomic_fetch_add_sint_single
+#  define port_memory_atomic_fetch_add_global_sint_single    port_memory_atomic_fetch_add_sint_single
+#  define port_memory_atomic_fetch_or_local_sint_single      port_memory_atomic_fetch_or_sint_single
+#  define port_memory_atomic_fetch_or_global_sint_single     port_memory_atomic_fetch_or_sint_single
+#  define port_memory_atomic_min_local_sint_single           port_memory_atomic_min_sint_single
+#  define port_memory_atomic_min_global_sint_single          port_memory_atomic_min_sint_single
+#  define port_memory_atomic_max_local_sint_single           port_memory_atomic_max_sint_single
+#  define port_memory_atomic_max_global_sint_single          port_memory_atomic_max_sint_single
+
+// Unsigned integer (double size)
+#  define port_memory_atomic_load_local_uint_double          port_memory_atomic_load_uint_double
+#  define port_memory_atomic_load_global_uint_double         port_memory_atomic_load_uint_double
+#  define port_memory_atomic_store_local_uint_double         port_memory_atomic_store_uint_double
+#  define port_memory_atomic_store_global_uint_double        port_memory_atomic_store_uint_double
+#  define port_memory_atomic_exchange_local_uint_double      port_memory_atomic_exchange_uint_double
+#  define port_memory_atomic_exchange_global_uint_double     port_memory_atomic_exchange_uint_double
+#  define port_memory_atomic_cas_local_uint_double           port_memory_atomic_cas_uint_double
+#  define port_memory_atomic_cas_global_uint_double          port_memory_atomic_cas_uint_double
+#  define port_memory_atomic_fetch_add_local_uint_double     port_memory_atomic_fetch_add_uint_double
+#  define port_memory_atomic_fetch_add_global_uint_double    port_memory_atomic_fetch_add_uint_double
+#  define port_memory_atomic_fetch_or_local_uint_double      port_memory_atomic_fetch_or_uint_double
+#  define port_memory_atomic_fetch_or_global_uint_double     port_memory_atomic_fetch_or_uint_double
+#  define port_memory_atomic_min_local_uint_double           port_memory_atomic_min_uint_double
+#  define port_memory_atomic_min_global_uint_double          port_memory_atomic_min_uint_double
+#  define port_memory_atomic_max_local_uint_double           port_memory_atomic_max_uint_double
+#  define port_memory_atomic_max_global_uint_double          port_memory_atomic_max_uint_double
+
+// Signed integer (double size)
+#  define port_memory_atomic_load_local_sint_double          port_memory_atomic_load_sint_double
+#  define port_memory_atomic_load_global_sint_double         port_memory_atomic_load_sint_double
+#  define port_memory_atomic_store_local_sint_double         port_memory_atomic_store_sint_double
+#  define port_memory_atomic_store_global_sint_double        port_memory_atomic_store_sint_double
+#  define port_memory_atomic_exchange_local_sint_double      port_memory_atomic_exchange_sint_double
+#  define port_memory_atomic_exchange_global_sint_double     port_memory_atomic_exchange_sint_double
+#  define port_memory_atomic_cas_local_sint_double           port_memory_atomic_cas_sint_double
+#  define port_memory_atomic_cas_global_sint_double          port_memory_atomic_cas_sint_double
+#  define port_memory_atomic_fetch_add_local_sint_double     port_memory_atomic_fetch_add_sint_double
+#  define port_memory_atomic_fetch_add_global_sint_double    port_memory_atomic_fetch_add_sint_double
+#  define port_memory_atomic_fetch_or_local_sint_double      port_memory_atomic_fetch_or_sint_double
+#  define port_memory_atomic_fetch_or_global_sint_double     port_memory_atomic_fetch_or_sint_double
+#  define port_memory_atomic_min_local_sint_double           port_memory_atomic_min_sint_double
+#  define port_memory_atomic_min_global_sint_double          port_memory_atomic_min_sint_double
+#  define port_memory_atomic_max_local_sint_double           port_memory_atomic_max_sint_double
+#  define port_memory_atomic_max_global_sint_double          port_memory_atomic_max_sint_double
+
+#else // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Atomic operations (named address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+// Unsigned integer (single size)
+port_uint_single_t port_memory_atomic_load_local_uint_single(const __local port_memory_unit_t *unit);
+port_uint_single_t port_memory_atomic_load_global_uint_single(const __global port_memory_unit_t *unit);
+void port_memory_atomic_store_local_uint_single(__local port_memory_unit_t *unit, port_uint_single_t value);
+void port_memory_atomic_store_global_uint_single(__global port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_exchange_local_uint_single(__local port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_exchange_global_uint_single(__global port_memory_unit_t *unit, port_uint_single_t value);
+bool port_memory_atomic_cas_local_uint_single(__local port_memory_unit_t *unit, port_uint_single_t *expected, port_uint_single_t desired);
+bool port_memory_atomic_cas_global_uint_single(__global port_memory_unit_t *unit, port_uint_single_t *expected, port_uint_single_t desired);
+port_uint_single_t port_memory_atomic_fetch_add_local_uint_single(__local port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_fetch_add_global_uint_single(__global port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_fetch_or_local_uint_single(__local port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_fetch_or_global_uint_single(__global port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_min_local_uint_single(__local port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_min_global_uint_single(__global port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_max_local_uint_single(__local port_memory_unit_t *unit, port_uint_single_t value);
+port_uint_single_t port_memory_atomic_max_global_uint_single(__global port_memory_unit_t *unit, port_uint_single_t value);
+
+// Signed integer (single size)
+port_sint_single_t port_memory_atomic_load_local_sint_single(const __local port_memory_unit_t *unit);
+port_sint_single_t port_memory_atomic_load_global_sint_single(const __global port_memory_unit_t *unit);
+void port_memory_atomic_store_local_sint_single(__local port_memory_unit_t *unit, port_sint_single_t value);
+void port_memory_atomic_store_global_sint_single(__global port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_exchange_local_sint_single(__local port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_exchange_global_sint_single(__global port_memory_unit_t *unit, port_sint_single_t value);
+bool port_memory_atomic_cas_local_sint_single(__local port_memory_unit_t *unit, port_sint_single_t *expected, port_sint_single_t desired);
+bool port_memory_atomic_cas_global_sint_single(__global port_memory_unit_t *unit, port_sint_single_t *expected, port_sint_single_t desired);
+port_sint_single_t port_memory_atomic_fetch_add_local_sint_single(__local port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_fetch_add_global_sint_single(__global port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_fetch_or_local_sint_single(__local port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_fetch_or_global_sint_single(__global port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_min_local_sint_single(__local port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_min_global_sint_single(__global port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_max_local_sint_single(__local port_memory_unit_t *unit, port_sint_single_t value);
+port_sint_single_t port_memory_atomic_max_global_sint_single(__global port_memory_unit_t *unit, port_sint_single_t value);
+
+#if defined(cl_khr_int64_base_atomics) && defined(cl_khr_int64_extended_atomics)
+
+// Unsigned integer (double size)
+port_uint_double_t port_memory_atomic_load_local_uint_double(const __local port_memory_unit_double_t *unit);
+port_uint_double_t port_memory_atomic_load_global_uint_double(const __global port_memory_unit_double_t *unit);
+void port_memory_atomic_store_local_uint_double(__local port_memory_unit_double_t *unit, port_uint_double_t value);
+void port_memory_atomic_store_global_uint_double(__global port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_exchange_local_uint_double(__local port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_exchange_global_uint_double(__global port_memory_unit_double_t *unit, port_uint_double_t value);
+bool port_memory_atomic_cas_local_uint_double(__local port_memory_unit_double_t *unit, port_uint_double_t *expected, port_uint_double_t desired);
+bool port_memory_atomic_cas_global_uint_double(__global port_memory_unit_double_t *unit, port_uint_double_t *expected, port_uint_double_t desired);
+port_uint_double_t port_memory_atomic_fetch_add_local_uint_double(__local port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_fetch_add_global_uint_double(__global port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_fetch_or_local_uint_double(__local port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_fetch_or_global_uint_double(__global port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_min_local_uint_double(__local port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_min_global_uint_double(__global port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_max_local_uint_double(__local port_memory_unit_double_t *unit, port_uint_double_t value);
+port_uint_double_t port_memory_atomic_max_global_uint_double(__global port_memory_unit_double_t *unit, port_uint_double_t value);
+
+// Signed integer (double size)
+port_sint_double_t port_memory_atomic_load_local_sint_double(const __local port_memory_unit_double_t *unit);
+port_sint_double_t port_memory_atomic_load_global_sint_double(const __global port_memory_unit_double_t *unit);
+void port_memory_atomic_store_local_sint_double(__local port_memory_unit_double_t *unit, port_sint_double_t value);
+void port_memory_atomic_store_global_sint_double(__global port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_exchange_local_sint_double(__local port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_exchange_global_sint_double(__global port_memory_unit_double_t *unit, port_sint_double_t value);
+bool port_memory_atomic_cas_local_sint_double(__local port_memory_unit_double_t *unit, port_sint_double_t *expected, port_sint_double_t desired);
+bool port_memory_atomic_cas_global_sint_double(__global port_memory_unit_double_t *unit, port_sint_double_t *expected, port_sint_double_t desired);
+port_sint_double_t port_memory_atomic_fetch_add_local_sint_double(__local port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_fetch_add_global_sint_double(__global port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_fetch_or_local_sint_double(__local port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_fetch_or_global_sint_double(__global port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_min_local_sint_double(__local port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_min_global_sint_double(__global port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_max_local_sint_double(__local port_memory_unit_double_t *unit, port_sint_double_t value);
+port_sint_double_t port_memory_atomic_max_global_sint_double(__global port_memory_unit_double_t *unit, port_sint_double_t value);
+
+#endif // cl_khr_int64_base_atomics && cl_khr_int64_extended_atomics
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_ATOMIC_FUN_H_
@@ -0,0 +1,177 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Definitions of atomic operations on memory units.
+ *
+ * Definitions are compiled into the library by default.
+ * If PORT_FEATURE_INLINE is defined, they are included by the corresponding
+ * .fun.h header as static inline functions instead.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_ATOMIC_INL_H_
+#define _PORT_MEMORY_ATOMIC_INL_H_
+
+#include "port/memory/unit.typ.h"
+#include "port/keywords.def.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <assert.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Atomic operations (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+#define ATOMIC(type, unit, field) ((_Atomic port_##type##_t*)&(unit)->field)
+
+#define DEFINE_ATOMIC_FUNCTIONS(type, unit_type, field) \
+PORT_INLINE port_##type##_t port_memory_atomic_load_##type(const unit_type *unit) \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    return atomic_load((const _Atomic port_##type##_t*)&unit->field);               \
+}                                                                                   \
+PORT_INLINE void port_memory_atomic_store_##type(unit_type *unit, port_##type##_t value) \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    atomic_store(ATOMIC(type, unit, field), value);                                 \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_exchange_##type(unit_type *unit, port_##type##_t value) \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    return atomic_exchange(ATOMIC(type, unit, field), value);                       \
+}                                                                                   \
+PORT_INLINE bool port_memory_atomic_cas_##type(unit_type *unit,                     \
+        port_##type##_t *expected, port_##type##_t desired)                         \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    assert(expected != NULL);                                                       \
+    return atomic_compare_exchange_strong(ATOMIC(type, unit, field), expected, desired); \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_fetch_add_##type(unit_type *unit, port_##type##_t value) \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    return atomic_fetch_add(ATOMIC(type, unit, field), value);                      \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_fetch_or_##type(unit_type *unit, port_##type##_t value) \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    return atomic_fetch_or(ATOMIC(type, unit, field), value);                       \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_min_##type(unit_type *unit, port_##type##_t value) \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    port_##type##_t old = atomic_load_explicit(ATOMIC(type, unit, field), memory_order_relaxed); \
+    while ((value < old) && !atomic_compare_exchange_weak(ATOMIC(type, unit, field), &old, value)); \
+    return old;                                                                     \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_max_##type(unit_type *unit, port_##type##_t value) \
+{                                                                                   \
+    assert(unit != NULL);                                                           \
+    port_##type##_t old = atomic_load_explicit(ATOMIC(type, unit, field), memory_order_relaxed); \
+    while ((value > old) && !atomic_compare_exchange_weak(ATOMIC(type, unit, field), &old, value)); \
+    return old;                                                                     \
+}
+
+DEFINE_ATOMIC_FUNCTIONS(uint_single, port_memory_unit_t, as_uint_single)
+DEFINE_ATOMIC_FUNCTIONS(sint_single, port_memory_unit_t, as_sint_single)
+DEFINE_ATOMIC_FUNCTIONS(uint_double, port_memory_unit_double_t, as_uint_double)
+DEFINE_ATOMIC_FUNCTIONS(sint_double, port_memory_unit_double_t, as_sint_double)
+
+#undef DEFINE_ATOMIC_FUNCTIONS
+#undef ATOMIC
+
+#else // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Atomic operations (named address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+// 32-bit built-ins are prefixed with atomic_, 64-bit ones with atom_
+#define DEFINE_ATOMIC_FUNCTIONS(type, unit_type, field, address_space, prefix) \
+PORT_INLINE port_##type##_t port_memory_atomic_load_##address_space##_##type( \
+        const __##address_space unit_type *unit)                                    \
+{                                                                                   \
+    return prefix##_or((volatile __##address_space port_##type##_t*)&unit->field, 0); \
+}                                                                                   \
+PORT_INLINE void port_memory_atomic_store_##address_space##_##type(                \
+        __##address_space unit_type *unit, port_##type##_t value)                   \
+{                                                                                   \
+    prefix##_xchg(&unit->field, value);                                             \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_exchange_##address_space##_##type(  \
+        __##address_space unit_type *unit, port_##type##_t value)                   \
+{                                                                                   \
+    return prefix##_xchg(&unit->field, value);                                      \
+}                                                                                   \
+PORT_INLINE bool port_memory_atomic_cas_##address_space##_##type(                  \
+        __##address_space unit_type *unit, port_##type##_t *expected, port_##type##_t desired) \
+{                                                                                   \
+    port_##type##_t old = prefix##_cmpxchg(&unit->field, *expected, desired);       \
+    bool success = (old == *expected);                                              \
+    *expected = old;                                                                \
+    return success;                                                                 \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_fetch_add_##address_space##_##type( \
+        __##address_space unit_type *unit, port_##type##_t value)                   \
+{                                                                                   \
+    return prefix##_add(&unit->field, value);                                       \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_fetch_or_##address_space##_##type(  \
+        __##address_space unit_type *unit, port_##type##_t value)                   \
+{                                                                                   \
+    return prefix##_or(&unit->field, value);                                        \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_min_##address_space##_##type(       \
+        __##address_space unit_type *unit, port_##type##_t value)                   \
+{                                                                                   \
+    return prefix##_min(&unit->field, value);                                       \
+}                                                                                   \
+PORT_INLINE port_##type##_t port_memory_atomic_max_##address_space##_##type(       \
+        __##address_space unit_type *unit, port_##type##_t value)                   \
+{                                                                                   \
+    return prefix##_max(&unit->field, value);                                       \
+}
+
+DEFINE_ATOMIC_FUNCTIONS(uint_single, port_memory_unit_t, as_uint_single, local, atomic)
+DEFINE_ATOMIC_FUNCTIONS(uint_single, port_memory_unit_t, as_uint_single, global, atomic)
+DEFINE_ATOMIC_FUNCTIONS(sint_single, port_memory_unit_t, as_sint_single, local, atomic)
+DEFINE_ATOMIC_FUNCTIONS(sint_single, port_memory_unit_t, as_sint_single, global, atomic)
+
+#if defined(cl_khr_int64_base_atomics) && defined(cl_khr_int64_extended_atomics)
+
+#pragma OPENCL EXTENSION cl_khr_int64_base_atomics : enable
+#pragma OPENCL EXTENSION cl_khr_int64_extended_atomics : enable
+
+DEFINE_ATOMIC_FUNCTIONS(uint_double, port_memory_unit_double_t, as_uint_double, local, atom)
+DEFINE_ATOMIC_FUNCTIONS(uint_double, port_memory_unit_double_t, as_uint_double, global, atom)
+DEFINE_ATOMIC_FUNCTIONS(sint_double, port_memory_unit_double_t, as_sint_double, local, atom)
+DEFINE_ATOMIC_FUNCTIONS(sint_double, port_memory_unit_double_t, as_sint_double, global, atom)
+
+#endif // cl_khr_int64_base_atomics && cl_khr_int64_extended_atomics
+
+#undef DEFINE_ATOMIC_FUNCTIONS
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_ATOMIC_INL_H_
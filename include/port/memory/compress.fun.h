@@ -0,0 +1,113 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Compression of cold memory segments.
+ *
+ * Memory references are replaced with zigzag-encoded differences from the same unit
+ * of the previous record, which are small for records referencing nearby data.
+ * Then every group of 32 units is bit-packed with the width of its largest value.
+ *
+ * Compressed segments are not resolved by port_memory_at() and others.
+ * Blocks are either accessed through a small cache of decompressed blocks,
+ * or the whole segment is materialized to be registered in a memory table again.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_COMPRESS_FUN_H_
+#define _PORT_MEMORY_COMPRESS_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/compress.typ.h"
+#include "port/pointer.typ.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Compress memory segment.
+ *
+ * Segment size must be a multiple of record size.
+ * Block size is rounded up to a multiple of record size.
+ * Map with zero number of units means that segment contains no memory references.
+ *
+ * @return Compressed segment, or NULL on failure.
+ */
+port_memory_compressed_segment_t*
+port_memory_compress_segment(
+        port_const_void_ptr_t memory, ///< [in] Segment memory.
+        size_t num_bytes, ///< [in] Segment size in bytes.
+        port_memory_ref_map_t map, ///< [in] Map of memory references in a record.
+        size_t block_units, ///< [in] Block size in units.
+        port_uint32_t cache_size ///< [in] Number of decompressed blocks to cache.
+);
+
+/**
+ * @brief Destroy compressed memory segment.
+ */
+void
+port_memory_compressed_segment_destroy(
+        port_memory_compressed_segment_t *segment ///< [in] Compressed segment.
+);
+
+/**
+ * @brief Get decompressed block of compressed segment.
+ *
+ * Block is decompressed into the cache unless it is cached already,
+ * evicting the least recently used block.
+ * Pointer is valid until the block is evicted.
+ * Is not thread-safe.
+ *
+ * @return Decompressed block, or NULL on failure.
+ */
+const port_memory_unit_t*
+port_memory_compressed_block(
+        port_memory_compressed_segment_t *segment, ///< [in] Compressed segment.
+        size_t block ///< [in] Block index.
+);
+
+/**
+ * @brief Get unit of compressed segment.
+ *
+ * @see port_memory_compressed_block()
+ *
+ * @return Pointer to decompressed unit, or NULL on failure.
+ */
+const port_memory_unit_t*
+port_memory_compressed_at(
+        port_memory_compressed_segment_t *segment, ///< [in] Compressed segment.
+        size_t offset ///< [in] Offset of unit in bytes.
+);
+
+/**
+ * @brief Decompress the whole segment.
+ *
+ * @return True on success, false on failure.
+ */
+bool
+port_memory_compressed_materialize(
+        const port_memory_compressed_segment_t *segment, ///< [in] Compressed segment.
+        port_void_ptr_t memory ///< [out] Memory for decompressed segment.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_COMPRESS_FUN_H_
@@ -0,0 +1,67 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for compressed memory segments.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_COMPRESS_TYP_H_
+#define _PORT_MEMORY_COMPRESS_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.typ.h"
+#include "port/memory/unit.typ.h"
+
+
+/**
+ * @brief Cache entry with decompressed block.
+ */
+typedef struct port_memory_compressed_cache_entry {
+    size_t block; ///< Index of cached block, or SIZE_MAX if entry is empty.
+    port_uint64_t last_use; ///< Time of the last use.
+    port_memory_unit_t *units; ///< Decompressed block.
+} port_memory_compressed_cache_entry_t;
+
+/**
+ * @brief Compressed memory segment.
+ *
+ * Segment is an array of records with the same map of memory references.
+ * It is split into blocks of whole records, which are compressed independently.
+ */
+typedef struct port_memory_compressed_segment {
+    port_memory_ref_map_t map; ///< Map of memory references in a record.
+
+    size_t num_units; ///< Segment size in units.
+    size_t block_units; ///< Block size in units.
+    size_t num_blocks; ///< Number of blocks.
+
+    size_t *block_offsets; ///< Offsets of compressed blocks in data (num_blocks + 1 elements).
+    port_uint8_t *data; ///< Compressed data.
+
+    port_uint32_t cache_size; ///< Number of cache entries.
+    port_uint64_t cache_time; ///< Counter of cache accesses.
+    port_memory_compressed_cache_entry_t *cache; ///< Cache of decompressed blocks.
+} port_memory_compressed_segment_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_COMPRESS_TYP_H_
@@ -27,6 +27,16 @@
 #define _PORT_MEMORY_COPY_FUN_H_
 
 #include "port/pointer.typ.h"
+#include "port/memory.typ.h"
+#include "port/memory/unit.typ.h"
+
+#ifndef __OPENCL_C_VERSION__
+#  include <stdbool.h>
+#endif
+
+#ifdef PORT_FEATURE_INLINE
+#  include "port/memory/copy.inl.h" // static inline definitions
+#endif
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,6 +53,30 @@ port_memory_copy(
         size_t num_bytes ///< [in] Number of bytes to copy.
 );
 
+/**
+ * @brief Copy array of nodes and remap memory references in them.
+ *
+ * All nodes have the same map of memory references.
+ * References are remapped right after copying of each node,
+ * so the block is traversed only once.
+ *
+ * On failure, destination block is left partially copied and partially remapped,
+ * and must not be used.
+ *
+ * @see port_memory_ref_remap_t
+ *
+ * @return True on success, false if a remapped reference cannot be encoded.
+ */
+bool
+port_memory_copy_remap(
+        port_memory_unit_t *restrict dest, ///< [out] Destination block.
+        const port_memory_unit_t *restrict src, ///< [in] Source block.
+        size_t num_nodes, ///< [in] Number of nodes in the block.
+        port_memory_ref_map_t map, ///< [in] Map of memory references in a node.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+        port_memory_ref_remap_t remap ///< [in] Remapping of memory references.
+);
+
 #ifdef __OPENCL_C_VERSION__
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,121 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Copy-on-write versioned segments.
+ *
+ * A new version shares all blocks with the version it is derived from.
+ * Writing to a block of a version copies only this block,
+ * so a snapshot costs time and memory proportional to the number of written blocks.
+ * Segments of a version are contiguous in memory, and its pointer table
+ * can be used as memory table for port_memory_at() and others.
+ *
+ * Functions are not thread-safe, but memory of versions can be read concurrently.
+ *
+ * Every run of adjacent blocks made writable by a single port_memory_cow_write() call
+ * becomes a separate memory mapping, which splits the mapping of its segment.
+ * Number of mappings of a process is limited by vm.max_map_count (65530 by default),
+ * and port_memory_cow_write() fails when the limit is reached.
+ * Scattered writes to N blocks of a version take up to 2N+1 mappings per segment,
+ * so block size must keep the number of written blocks of all live versions well below the limit.
+ * For example, scattered writes to 2% of a 4 GiB data set take about 42000 mappings
+ * with 4 KiB blocks, and about 2600 mappings with 64 KiB blocks.
+ * For data sets of gigabytes, block size of at least 64 KiB is recommended.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_COW_FUN_H_
+#define _PORT_MEMORY_COW_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/cow.typ.h"
+
+
+/**
+ * @brief Create store of copy-on-write segment blocks.
+ *
+ * Block size must be a multiple of page size.
+ *
+ * @return Block store, or NULL on failure.
+ */
+port_memory_cow_t*
+port_memory_cow_create(
+        port_uint32_t num_segments, ///< [in] Number of segments.
+        const size_t segment_sizes[], ///< [in] Segment sizes in bytes.
+        size_t block_size ///< [in] Block size in bytes.
+);
+
+/**
+ * @brief Destroy store of copy-on-write segment blocks.
+ *
+ * All versions must be destroyed beforehand.
+ */
+void
+port_memory_cow_destroy(
+        port_memory_cow_t *cow ///< [in] Block store.
+);
+
+/**
+ * @brief Create version of segments.
+ *
+ * If base version is NULL, segments of the new version are zero-initialized and writable.
+ * Otherwise, all blocks are shared with the base version.
+ *
+ * Shared blocks of the base version are made read-only too, so pointers
+ * to its memory previously returned by port_memory_cow_write() become invalid for writing,
+ * and the base version must be prepared for writing with port_memory_cow_write() again.
+ *
+ * @return Version, or NULL on failure.
+ */
+port_memory_cow_version_t*
+port_memory_cow_version_create(
+        port_memory_cow_t *cow, ///< [in] Block store.
+        port_memory_cow_version_t *base ///< [in,out] Base version, or NULL.
+);
+
+/**
+ * @brief Destroy version of segments.
+ *
+ * Blocks that are not shared with other versions are released.
+ */
+void
+port_memory_cow_version_destroy(
+        port_memory_cow_version_t *version ///< [in] Version.
+);
+
+/**
+ * @brief Prepare byte range of segment for writing.
+ *
+ * Blocks of the range that are shared with other versions are copied.
+ *
+ * @return Writable pointer to the range, or NULL on failure.
+ */
+port_void_ptr_t
+port_memory_cow_write(
+        port_memory_cow_version_t *version, ///< [in] Version.
+        port_uint32_t tidx, ///< [in] Table index of segment.
+        size_t offset, ///< [in] Offset of range in bytes.
+        size_t num_bytes ///< [in] Size of range in bytes.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_COW_FUN_H_
@@ -0,0 +1,74 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for copy-on-write versioned segments.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_COW_TYP_H_
+#define _PORT_MEMORY_COW_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/types.typ.h"
+#include "port/pointer.typ.h"
+
+
+/**
+ * @brief Store of copy-on-write segment blocks.
+ *
+ * Blocks of all versions live in a single memory file.
+ * A block is shared by the versions that have not written to it.
+ */
+typedef struct port_memory_cow {
+    int fd; ///< Memory file descriptor.
+    size_t block_size; ///< Block size in bytes.
+
+    port_uint32_t num_segments; ///< Number of segments in each version.
+    size_t *segment_sizes; ///< Segment sizes in bytes.
+    size_t *segment_num_blocks; ///< Segment sizes in blocks.
+
+    port_uint32_t *refcounts; ///< Number of versions sharing each file block.
+    size_t num_file_blocks; ///< Number of file blocks ever allocated.
+    size_t file_capacity; ///< File size in blocks.
+
+    size_t *free_blocks; ///< Stack of released file blocks.
+    size_t num_free_blocks; ///< Number of released file blocks.
+} port_memory_cow_t;
+
+/**
+ * @brief Version of copy-on-write segments.
+ *
+ * Blocks shared with other versions are mapped read-only,
+ * so they must be made private with port_memory_cow_write() before writing.
+ */
+typedef struct port_memory_cow_version {
+    port_memory_cow_t *cow; ///< Block store.
+
+    port_const_void_ptr_t *pointers; ///< Table of memory pointers for port_memory_at() and others.
+
+    size_t **blocks; ///< File block of each segment block.
+    port_uint8_t **writable; ///< Whether segment block is private and mapped writable.
+} port_memory_cow_version_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_COW_TYP_H_
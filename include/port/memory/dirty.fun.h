@@ -0,0 +1,116 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Dirty range tracking for incremental segment transfers.
+ *
+ * Segments are split into blocks of equal size, and every block has a dirty bit.
+ * Writers mark modified ranges, which is safe to do from several threads concurrently.
+ * Readers obtain coalesced ranges of dirty blocks and clear them,
+ * then transfer the ranges with clEnqueueWriteBuffer(), memcpy() or similar.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_DIRTY_FUN_H_
+#define _PORT_MEMORY_DIRTY_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/dirty.typ.h"
+#include "port/memory/table.typ.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Create dirty range tracker for segments of memory table.
+ *
+ * Only segments registered at the moment of creation are tracked.
+ * All blocks are clean initially.
+ *
+ * @return Tracker, or NULL on failure.
+ */
+port_memory_dirty_t*
+port_memory_dirty_create(
+        const port_memory_table_t *table, ///< [in] Memory table.
+        port_uint8_t block_size_log2 ///< [in] Binary logarithm of block size in bytes.
+);
+
+/**
+ * @brief Destroy dirty range tracker.
+ */
+void
+port_memory_dirty_destroy(
+        port_memory_dirty_t *dirty ///< [in] Tracker.
+);
+
+/**
+ * @brief Mark byte range of segment as dirty.
+ *
+ * Range is clipped to the segment size.
+ * Is thread-safe; marking has release semantics, so memory writes done
+ * before marking are visible to a thread that obtains the range.
+ */
+void
+port_memory_dirty_mark(
+        port_memory_dirty_t *dirty, ///< [in] Tracker.
+        port_uint32_t tidx, ///< [in] Table index of segment.
+        size_t offset, ///< [in] Offset of range in bytes.
+        size_t num_bytes ///< [in] Size of range in bytes.
+);
+
+/**
+ * @brief Mark memory range as dirty.
+ *
+ * Segment is found by address.
+ *
+ * @return True if range belongs to a tracked segment, otherwise false.
+ */
+bool
+port_memory_dirty_mark_ptr(
+        port_memory_dirty_t *dirty, ///< [in] Tracker.
+        port_const_void_ptr_t memory, ///< [in] Start of range.
+        size_t num_bytes ///< [in] Size of range in bytes.
+);
+
+/**
+ * @brief Find next coalesced range of dirty blocks of segment.
+ *
+ * Search starts at the block containing *offset.
+ * The found range consists of consecutive dirty blocks and is clipped to the segment size.
+ * To iterate over all ranges, start with zero offset and continue with offset + num_bytes.
+ *
+ * If clear is true, blocks of the found range are marked clean.
+ * Blocks marked dirty concurrently stay dirty unless they are in the returned range.
+ *
+ * @return True if range is found, otherwise false.
+ */
+bool
+port_memory_dirty_next_range(
+        port_memory_dirty_t *dirty, ///< [in] Tracker.
+        port_uint32_t tidx, ///< [in] Table index of segment.
+        size_t *offset, ///< [in,out] Search start / range offset in bytes.
+        size_t *num_bytes, ///< [out] Range size in bytes.
+        bool clear ///< [in] Whether to mark found blocks clean.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_DIRTY_FUN_H_
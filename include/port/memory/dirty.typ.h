@@ -0,0 +1,60 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for dirty range tracking.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_DIRTY_TYP_H_
+#define _PORT_MEMORY_DIRTY_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/types.typ.h"
+#include "port/pointer.typ.h"
+
+#include <stdatomic.h>
+
+
+/**
+ * @brief Dirty bitmap of a memory segment.
+ */
+typedef struct port_memory_dirty_segment {
+    port_const_void_ptr_t memory; ///< Segment memory.
+    size_t num_bytes; ///< Segment size in bytes.
+
+    _Atomic port_uint64_t *bits; ///< Bitmap with a bit per block.
+    size_t num_words; ///< Number of bitmap words.
+} port_memory_dirty_segment_t;
+
+/**
+ * @brief Dirty range tracker of memory table segments.
+ */
+typedef struct port_memory_dirty {
+    port_uint8_t block_size_log2; ///< Binary logarithm of block size in bytes.
+
+    port_uint32_t num_segments; ///< Number of tracked segments.
+    port_memory_dirty_segment_t *segments; ///< Tracked segments (indexed by table index).
+} port_memory_dirty_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_DIRTY_TYP_H_
@@ -0,0 +1,354 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Strided, gather and scatter access to arrays of built-in types.
+ *
+ * Offsets, strides and indices are measured in elements of the accessed type.
+ * Strided functions access elements memory[offset + i*stride],
+ * gather and scatter functions access elements memory[indices[i]], for i < count.
+ * If indices repeat, scatter functions store the value with the greatest i.
+ *
+ * On x86-64 CPUs, 32-bit and 64-bit element types use AVX2 gathers
+ * and AVX-512 gathers/scatters when the library is compiled with support for them.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_GATHER_FUN_H_
+#define _PORT_MEMORY_GATHER_FUN_H_
+
+#include "port/pointer.typ.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for built-in types (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+// Unsigned integer (8-bit)
+void port_memory_read_uint8_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint8_t *out);
+void port_memory_write_uint8_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint8_t *in);
+void port_memory_gather_uint8(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint8_t *out);
+void port_memory_scatter_uint8(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint8_t *in);
+
+// Unsigned integer (16-bit)
+void port_memory_read_uint16_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint16_t *out);
+void port_memory_write_uint16_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint16_t *in);
+void port_memory_gather_uint16(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint16_t *out);
+void port_memory_scatter_uint16(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint16_t *in);
+
+// Unsigned integer (32-bit)
+void port_memory_read_uint32_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint32_t *out);
+void port_memory_write_uint32_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint32_t *in);
+void port_memory_gather_uint32(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint32_t *out);
+void port_memory_scatter_uint32(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint32_t *in);
+
+// Unsigned integer (64-bit)
+void port_memory_read_uint64_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint64_t *out);
+void port_memory_write_uint64_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint64_t *in);
+void port_memory_gather_uint64(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint64_t *out);
+void port_memory_scatter_uint64(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint64_t *in);
+
+// Signed integer (8-bit)
+void port_memory_read_sint8_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint8_t *out);
+void port_memory_write_sint8_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint8_t *in);
+void port_memory_gather_sint8(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint8_t *out);
+void port_memory_scatter_sint8(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint8_t *in);
+
+// Signed integer (16-bit)
+void port_memory_read_sint16_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint16_t *out);
+void port_memory_write_sint16_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint16_t *in);
+void port_memory_gather_sint16(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint16_t *out);
+void port_memory_scatter_sint16(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint16_t *in);
+
+// Signed integer (32-bit)
+void port_memory_read_sint32_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint32_t *out);
+void port_memory_write_sint32_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint32_t *in);
+void port_memory_gather_sint32(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint32_t *out);
+void port_memory_scatter_sint32(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint32_t *in);
+
+// Signed integer (64-bit)
+void port_memory_read_sint64_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint64_t *out);
+void port_memory_write_sint64_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint64_t *in);
+void port_memory_gather_sint64(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint64_t *out);
+void port_memory_scatter_sint64(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint64_t *in);
+
+// Floating-point number (32-bit)
+void port_memory_read_float32_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float32_t *out);
+void port_memory_write_float32_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_float32_t *in);
+void port_memory_gather_float32(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float32_t *out);
+void port_memory_scatter_float32(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_float32_t *in);
+
+// Floating-point number (64-bit)
+void port_memory_read_float64_strided(port_const_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float64_t *out);
+void port_memory_write_float64_strided(port_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_float64_t *in);
+void port_memory_gather_float64(port_const_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float64_t *out);
+void port_memory_scatter_float64(port_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_float64_t *in);
+
+#ifdef __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for built-in types (named address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+// Unsigned integer (8-bit)
+void port_memory_read_local_uint8_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint8_t *out);
+void port_memory_read_global_uint8_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint8_t *out);
+void port_memory_read_constant_uint8_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint8_t *out);
+void port_memory_write_local_uint8_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint8_t *in);
+void port_memory_write_global_uint8_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint8_t *in);
+void port_memory_gather_local_uint8(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint8_t *out);
+void port_memory_gather_global_uint8(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint8_t *out);
+void port_memory_gather_constant_uint8(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint8_t *out);
+void port_memory_scatter_local_uint8(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint8_t *in);
+void port_memory_scatter_global_uint8(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint8_t *in);
+
+// Unsigned integer (16-bit)
+void port_memory_read_local_uint16_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint16_t *out);
+void port_memory_read_global_uint16_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint16_t *out);
+void port_memory_read_constant_uint16_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint16_t *out);
+void port_memory_write_local_uint16_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint16_t *in);
+void port_memory_write_global_uint16_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint16_t *in);
+void port_memory_gather_local_uint16(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint16_t *out);
+void port_memory_gather_global_uint16(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint16_t *out);
+void port_memory_gather_constant_uint16(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint16_t *out);
+void port_memory_scatter_local_uint16(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint16_t *in);
+void port_memory_scatter_global_uint16(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint16_t *in);
+
+// Unsigned integer (32-bit)
+void port_memory_read_local_uint32_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint32_t *out);
+void port_memory_read_global_uint32_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint32_t *out);
+void port_memory_read_constant_uint32_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint32_t *out);
+void port_memory_write_local_uint32_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint32_t *in);
+void port_memory_write_global_uint32_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint32_t *in);
+void port_memory_gather_local_uint32(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint32_t *out);
+void port_memory_gather_global_uint32(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint32_t *out);
+void port_memory_gather_constant_uint32(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint32_t *out);
+void port_memory_scatter_local_uint32(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint32_t *in);
+void port_memory_scatter_global_uint32(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint32_t *in);
+
+// Unsigned integer (64-bit)
+void port_memory_read_local_uint64_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint64_t *out);
+void port_memory_read_global_uint64_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint64_t *out);
+void port_memory_read_constant_uint64_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_uint64_t *out);
+void port_memory_write_local_uint64_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint64_t *in);
+void port_memory_write_global_uint64_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_uint64_t *in);
+void port_memory_gather_local_uint64(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint64_t *out);
+void port_memory_gather_global_uint64(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint64_t *out);
+void port_memory_gather_constant_uint64(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_uint64_t *out);
+void port_memory_scatter_local_uint64(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint64_t *in);
+void port_memory_scatter_global_uint64(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_uint64_t *in);
+
+// Signed integer (8-bit)
+void port_memory_read_local_sint8_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint8_t *out);
+void port_memory_read_global_sint8_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint8_t *out);
+void port_memory_read_constant_sint8_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint8_t *out);
+void port_memory_write_local_sint8_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint8_t *in);
+void port_memory_write_global_sint8_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint8_t *in);
+void port_memory_gather_local_sint8(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint8_t *out);
+void port_memory_gather_global_sint8(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint8_t *out);
+void port_memory_gather_constant_sint8(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint8_t *out);
+void port_memory_scatter_local_sint8(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint8_t *in);
+void port_memory_scatter_global_sint8(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint8_t *in);
+
+// Signed integer (16-bit)
+void port_memory_read_local_sint16_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint16_t *out);
+void port_memory_read_global_sint16_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint16_t *out);
+void port_memory_read_constant_sint16_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint16_t *out);
+void port_memory_write_local_sint16_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint16_t *in);
+void port_memory_write_global_sint16_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint16_t *in);
+void port_memory_gather_local_sint16(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint16_t *out);
+void port_memory_gather_global_sint16(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint16_t *out);
+void port_memory_gather_constant_sint16(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint16_t *out);
+void port_memory_scatter_local_sint16(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint16_t *in);
+void port_memory_scatter_global_sint16(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint16_t *in);
+
+// Signed integer (32-bit)
+void port_memory_read_local_sint32_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint32_t *out);
+void port_memory_read_global_sint32_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint32_t *out);
+void port_memory_read_constant_sint32_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint32_t *out);
+void port_memory_write_local_sint32_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint32_t *in);
+void port_memory_write_global_sint32_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint32_t *in);
+void port_memory_gather_local_sint32(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint32_t *out);
+void port_memory_gather_global_sint32(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint32_t *out);
+void port_memory_gather_constant_sint32(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint32_t *out);
+void port_memory_scatter_local_sint32(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint32_t *in);
+void port_memory_scatter_global_sint32(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint32_t *in);
+
+// Signed integer (64-bit)
+void port_memory_read_local_sint64_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint64_t *out);
+void port_memory_read_global_sint64_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint64_t *out);
+void port_memory_read_constant_sint64_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_sint64_t *out);
+void port_memory_write_local_sint64_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint64_t *in);
+void port_memory_write_global_sint64_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_sint64_t *in);
+void port_memory_gather_local_sint64(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint64_t *out);
+void port_memory_gather_global_sint64(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint64_t *out);
+void port_memory_gather_constant_sint64(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_sint64_t *out);
+void port_memory_scatter_local_sint64(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint64_t *in);
+void port_memory_scatter_global_sint64(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_sint64_t *in);
+
+// Floating-point number (32-bit)
+void port_memory_read_local_float32_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float32_t *out);
+void port_memory_read_global_float32_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float32_t *out);
+void port_memory_read_constant_float32_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float32_t *out);
+void port_memory_write_local_float32_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_float32_t *in);
+void port_memory_write_global_float32_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_float32_t *in);
+void port_memory_gather_local_float32(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float32_t *out);
+void port_memory_gather_global_float32(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float32_t *out);
+void port_memory_gather_constant_float32(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float32_t *out);
+void port_memory_scatter_local_float32(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_float32_t *in);
+void port_memory_scatter_global_float32(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_float32_t *in);
+
+// Floating-point number (64-bit)
+void port_memory_read_local_float64_strided(port_const_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float64_t *out);
+void port_memory_read_global_float64_strided(port_const_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float64_t *out);
+void port_memory_read_constant_float64_strided(port_constant_void_ptr_t memory, size_t offset, size_t stride, size_t count, port_float64_t *out);
+void port_memory_write_local_float64_strided(port_local_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_float64_t *in);
+void port_memory_write_global_float64_strided(port_global_void_ptr_t memory, size_t offset, size_t stride, size_t count, const port_float64_t *in);
+void port_memory_gather_local_float64(port_const_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float64_t *out);
+void port_memory_gather_global_float64(port_const_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float64_t *out);
+void port_memory_gather_constant_float64(port_constant_void_ptr_t memory, const port_uint32_t *indices, size_t count, port_float64_t *out);
+void port_memory_scatter_local_float64(port_local_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_float64_t *in);
+void port_memory_scatter_global_float64(port_global_void_ptr_t memory, const port_uint32_t *indices, size_t count, const port_float64_t *in);
+
+#else // __OPENCL_C_VERSION__
+
+// Unsigned integer (8-bit)
+#  define port_memory_read_local_uint8_strided        port_memory_read_uint8_strided
+#  define port_memory_read_global_uint8_strided       port_memory_read_uint8_strided
+#  define port_memory_read_constant_uint8_strided     port_memory_read_uint8_strided
+#  define port_memory_write_local_uint8_strided       port_memory_write_uint8_strided
+#  define port_memory_write_global_uint8_strided      port_memory_write_uint8_strided
+#  define port_memory_gather_local_uint8              port_memory_gather_uint8
+#  define port_memory_gather_global_uint8             port_memory_gather_uint8
+#  define port_memory_gather_constant_uint8           port_memory_gather_uint8
+#  define port_memory_scatter_local_uint8             port_memory_scatter_uint8
+#  define port_memory_scatter_global_uint8            port_memory_scatter_uint8
+
+// Unsigned integer (16-bit)
+#  define port_memory_read_local_uint16_strided       port_memory_read_uint16_strided
+#  define port_memory_read_global_uint16_strided      port_memory_read_uint16_strided
+#  define port_memory_read_constant_uint16_strided    port_memory_read_uint16_strided
+#  define port_memory_write_local_uint16_strided      port_memory_write_uint16_strided
+#  define port_memory_write_global_uint16_strided     port_memory_write_uint16_strided
+#  define port_memory_gather_local_uint16             port_memory_gather_uint16
+#  define port_memory_gather_global_uint16            port_memory_gather_uint16
+#  define port_memory_gather_constant_uint16          port_memory_gather_uint16
+#  define port_memory_scatter_local_uint16            port_memory_scatter_uint16
+#  define port_memory_scatter_global_uint16           port_memory_scatter_uint16
+
+// Unsigned integer (32-bit)
+#  define port_memory_read_local_uint32_strided       port_memory_read_uint32_strided
+#  define port_memory_read_global_uint32_strided      port_memory_read_uint32_strided
+#  define port_memory_read_constant_uint32_strided    port_memory_read_uint32_strided
+#  define port_memory_write_local_uint32_strided      port_memory_write_uint32_strided
+#  define port_memory_write_global_uint32_strided     port_memory_write_uint32_strided
+#  define port_memory_gather_local_uint32             port_memory_gather_uint32
+#  define port_memory_gather_global_uint32            port_memory_gather_uint32
+#  define port_memory_gather_constant_uint32          port_memory_gather_uint32
+#  define port_memory_scatter_local_uint32            port_memory_scatter_uint32
+#  define port_memory_scatter_global_uint32           port_memory_scatter_uint32
+
+// Unsigned integer (64-bit)
+#  define port_memory_read_local_uint64_strided       port_memory_read_uint64_strided
+#  define port_memory_read_global_uint64_strided      port_memory_read_uint64_strided
+#  define port_memory_read_constant_uint64_strided    port_memory_read_uint64_strided
+#  define port_memory_write_local_uint64_strided      port_memory_write_uint64_strided
+#  define port_memory_write_global_uint64_strided     port_memory_write_uint64_strided
+#  define port_memory_gather_local_uint64             port_memory_gather_uint64
+#  define port_memory_gather_global_uint64            port_memory_gather_uint64
+#  define port_memory_gather_constant_uint64          port_memory_gather_uint64
+#  define port_memory_scatter_local_uint64            port_memory_scatter_uint64
+#  define port_memory_scatter_global_uint64           port_memory_scatter_uint64
+
+// Signed integer (8-bit)
+#  define port_memory_read_local_sint8_strided        port_memory_read_sint8_strided
+#  define port_memory_read_global_sint8_strided       port_memory_read_sint8_strided
+#  define port_memory_read_constant_sint8_strided     port_memory_read_sint8_strided
+#  define port_memory_write_local_sint8_strided       port_memory_write_sint8_strided
+#  define port_memory_write_global_sint8_strided      port_memory_write_sint8_strided
+#  define port_memory_gather_local_sint8              port_memory_gather_sint8
+#  define port_memory_gather_global_sint8             port_memory_gather_sint8
+#  define port_memory_gather_constant_sint8           port_memory_gather_sint8
+#  define port_memory_scatter_local_sint8             port_memory_scatter_sint8
+#  define port_memory_scatter_global_sint8            port_memory_scatter_sint8
+
+// Signed integer (16-bit)
+#  define port_memory_read_local_sint16_strided       port_memory_read_sint16_strided
+#  define port_memory_read_global_sint16_strided      port_memory_read_sint16_strided
+#  define port_memory_read_constant_sint16_strided    port_memory_read_sint16_strided
+#  define port_memory_write_local_sint16_strided      port_memory_write_sint16_strided
+#  define port_memory_write_global_sint16_strided     port_memory_write_sint16_strided
+#  define port_memory_gather_local_sint16             port_memory_gather_sint16
+#  define port_memory_gather_global_sint16            port_memory_gather_sint16
+#  define port_memory_gather_constant_sint16          port_memory_gather_sint16
+#  define port_memory_scatter_local_sint16            port_memory_scatter_sint16
+#  define port_memory_scatter_global_sint16           port_memory_scatter_sint16
+
+// Signed integer (32-bit)
+#  define port_memory_read_local_sint32_strided       port_memory_read_sint32_strided
+#  define port_memory_read_global_sint32_strided      port_memory_read_sint32_strided
+#  define port_memory_read_constant_sint32_strided    port_memory_read_sint32_strided
+#  define port_memory_write_local_sint32_strided      port_memory_write_sint32_strided
+#  define port_memory_write_global_sint32_strided     port_memory_write_sint32_strided
+#  define port_memory_gather_local_sint32             port_memory_gather_sint32
+#  define port_memory_gather_global_sint32            port_memory_gather_sint32
+#  define port_memory_gather_constant_sint32          port_memory_gather_sint32
+#  define port_memory_scatter_local_sint32            port_memory_scatter_sint32
+#  define port_memory_scatter_global_sint32           port_memory_scatter_sint32
+
+// Signed integer (64-bit)
+#  define port_memory_read_local_sint64_strided       port_memory_read_sint64_strided
+#  define port_memory_read_global_sint64_strided      port_memory_read_sint64_strided
+#  define port_memory_read_constant_sint64_strided    port_memory_read_sint64_strided
+#  define port_memory_write_local_sint64_strided      port_memory_write_sint64_strided
+#  define port_memory_write_global_sint64_strided     port_memory_write_sint64_strided
+#  define port_memory_gather_local_sint64             port_memory_gather_sint64
+#  define port_memory_gather_global_sint64            port_memory_gather_sint64
+#  define port_memory_gather_constant_sint64          port_memory_gather_sint64
+#  define port_memory_scatter_local_sint64            port_memory_scatter_sint64
+#  define port_memory_scatter_global_sint64           port_memory_scatter_sint64
+
+// Floating-point number (32-bit)
+#  define port_memory_read_local_float32_strided      port_memory_read_float32_strided
+#  define port_memory_read_global_float32_strided     port_memory_read_float32_strided
+#  define port_memory_read_constant_float32_strided   port_memory_read_float32_strided
+#  define port_memory_write_local_float32_strided     port_memory_write_float32_strided
+#  define port_memory_write_global_float32_strided    port_memory_write_float32_strided
+#  define port_memory_gather_local_float32            port_memory_gather_float32
+#  define port_memory_gather_global_float32           port_memory_gather_float32
+#  define port_memory_gather_constant_float32         port_memory_gather_float32
+#  define port_memory_scatter_local_float32           port_memory_scatter_float32
+#  define port_memory_scatter_global_float32          port_memory_scatter_float32
+
+// Floating-point number (64-bit)
+#  define port_memory_read_local_float64_strided      port_memory_read_float64_strided
+#  define port_memory_read_global_float64_strided     port_memory_read_float64_strided
+#  define port_memory_read_constant_float64_strided   port_memory_read_float64_strided
+#  define port_memory_write_local_float64_strided     port_memory_write_float64_strided
+#  define port_memory_write_global_float64_strided    port_memory_write_float64_strided
+#  define port_memory_gather_local_float64            port_memory_gather_float64
+#  define port_memory_gather_global_float64           port_memory_gather_float64
+#  define port_memory_gather_constant_float64         port_memory_gather_float64
+#  define port_memory_scatter_local_float64           port_memory_scatter_float64
+#  define port_memory_scatter_global_float64          port_memory_scatter_float64
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_GATHER_FUN_H_
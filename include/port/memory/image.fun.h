@@ -0,0 +1,72 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Memory image files.
+ *
+ * A memory image stores segments of a memory table.
+ * As memory references are position-independent, loading an image
+ * requires no parsing or copying: segments are mapped from the file directly.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_IMAGE_FUN_H_
+#define _PORT_MEMORY_IMAGE_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/image.typ.h"
+#include "port/memory/table.typ.h"
+
+
+/**
+ * @brief Write segments of memory table to memory image file.
+ *
+ * Alignment must be a power of two and a multiple of the page size,
+ * 0 means the page size. Empty segments are not supported.
+ *
+ * @return True on success, false on failure.
+ */
+bool
+port_memory_image_write(
+        const char *path, ///< [in] Path to memory image file.
+        const port_memory_table_t *table, ///< [in] Memory table.
+        size_t alignment ///< [in] Alignment of segment payloads in the file.
+);
+
+/**
+ * @brief Load memory image file.
+ *
+ * Every segment is mapped from the file with mmap() and registered
+ * in a new memory table, which owns the mappings.
+ * Writable segments are private copy-on-write mappings:
+ * modifications are not written back to the file.
+ *
+ * @return Memory table, or NULL on failure.
+ */
+port_memory_table_t*
+port_memory_image_load(
+        const char *path, ///< [in] Path to memory image file.
+        bool writable ///< [in] Whether segments are writable.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_IMAGE_FUN_H_
@@ -0,0 +1,75 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types of memory image files.
+ *
+ * Memory image file layout:
+ * - header (port_memory_image_header_t);
+ * - segment descriptors (port_memory_image_segment_t), one per segment in the order of table indices;
+ * - segment payloads, each starting at offset aligned to the image alignment.
+ *
+ * All fields are stored in native byte order.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_IMAGE_TYP_H_
+#define _PORT_MEMORY_IMAGE_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/types.typ.h"
+
+
+#define PORT_MEMORY_IMAGE_MAGIC         "PORTMIMG"  ///< Memory image file signature.
+#define PORT_MEMORY_IMAGE_VERSION       1           ///< Memory image format version.
+#define PORT_MEMORY_IMAGE_BYTE_ORDER    0x01020304  ///< Value for detecting byte order mismatch.
+
+/**
+ * @brief Memory image file header.
+ */
+typedef struct port_memory_image_header {
+    char magic[8]; ///< File signature (PORT_MEMORY_IMAGE_MAGIC without terminating null).
+    port_uint32_t version; ///< Format version (PORT_MEMORY_IMAGE_VERSION).
+    port_uint32_t byte_order; ///< PORT_MEMORY_IMAGE_BYTE_ORDER in byte order of the file.
+
+    port_uint64_t alignment; ///< Alignment of segment payloads in the file.
+
+    port_uint64_t max_segment_size; ///< Maximum segment size of the memory table.
+    port_uint32_t max_segments; ///< Maximum number of segments of the memory table.
+    port_uint32_t num_segments; ///< Number of segments in the image.
+
+    port_uint8_t far_num_tidx_bits; ///< Memory reference format: number of table index bits.
+    port_uint8_t far_offset_lshift; ///< Memory reference format: far offset scale.
+    port_uint8_t near_offset_lshift; ///< Memory reference format: near offset scale.
+    port_uint8_t reserved[5]; ///< Reserved, must be zero.
+} port_memory_image_header_t;
+
+/**
+ * @brief Memory image segment descriptor.
+ */
+typedef struct port_memory_image_segment {
+    port_uint64_t offset; ///< Offset of segment payload in the file.
+    port_uint64_t num_bytes; ///< Segment size in bytes.
+} port_memory_image_segment_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_IMAGE_TYP_H_
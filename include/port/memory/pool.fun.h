@@ -0,0 +1,140 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Fixed-size block pools.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_POOL_FUN_H_
+#define _PORT_MEMORY_POOL_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/pool.typ.h"
+#include "port/pointer.typ.h"
+
+#include <stdbool.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Pool
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Initialize pool over segment.
+ *
+ * Blocks are aligned to the far offset scale, all of them are free initially.
+ *
+ * @return True on success, false if no block can be referenced.
+ */
+bool
+port_memory_pool_init(
+        port_memory_pool_t *pool, ///< [out] Pool.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+
+        port_void_ptr_t memory, ///< [in] Segment memory.
+        size_t num_bytes, ///< [in] Segment size in bytes.
+        port_uint32_t tidx, ///< [in] Memory table index of the segment.
+
+        size_t block_units ///< [in] Block size in units.
+);
+
+/**
+ * @brief Get pointer to pool block.
+ *
+ * @return Pointer to block.
+ */
+port_void_ptr_t
+port_memory_pool_block(
+        const port_memory_pool_t *pool, ///< [in] Pool.
+        port_memory_ref_t ref ///< [in] Far reference to block.
+);
+
+/**
+ * @brief Allocate block from pool.
+ *
+ * @return Pointer to block, or NULL if pool is exhausted.
+ */
+port_void_ptr_t
+port_memory_pool_alloc(
+        port_memory_pool_t *pool, ///< [in,out] Pool.
+
+        port_memory_ref_t *ref ///< [out] Far reference to block, or NULL.
+);
+
+/**
+ * @brief Return block to pool.
+ */
+void
+port_memory_pool_free(
+        port_memory_pool_t *pool, ///< [in,out] Pool.
+        port_memory_ref_t ref ///< [in] Far reference to block.
+);
+
+///////////////////////////////////////////////////////////////////////////////
+// Thread-local cache
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Initialize empty pool cache.
+ */
+void
+port_memory_pool_cache_init(
+        port_memory_pool_cache_t *cache, ///< [out] Cache.
+        port_memory_pool_t *pool, ///< [in] Pool.
+        size_t batch_size ///< [in] Number of blocks moved between cache and pool at once.
+);
+
+/**
+ * @brief Allocate block using pool cache.
+ *
+ * Cache is refilled from the pool when empty.
+ *
+ * @return Pointer to block, or NULL if pool is exhausted.
+ */
+port_void_ptr_t
+port_memory_pool_cache_alloc(
+        port_memory_pool_cache_t *cache, ///< [in,out] Cache.
+
+        port_memory_ref_t *ref ///< [out] Far reference to block, or NULL.
+);
+
+/**
+ * @brief Return block to pool cache.
+ *
+ * A batch of blocks is returned to the pool when cache holds two batches.
+ */
+void
+port_memory_pool_cache_free(
+        port_memory_pool_cache_t *cache, ///< [in,out] Cache.
+        port_memory_ref_t ref ///< [in] Far reference to block.
+);
+
+/**
+ * @brief Return all cached blocks to pool.
+ */
+void
+port_memory_pool_cache_flush(
+        port_memory_pool_cache_t *cache ///< [in,out] Cache.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_POOL_FUN_H_
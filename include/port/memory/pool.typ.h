@@ -0,0 +1,77 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for fixed-size block pools.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_POOL_TYP_H_
+#define _PORT_MEMORY_POOL_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.typ.h"
+#include "port/memory/unit.typ.h"
+
+#include <stdatomic.h>
+
+/**
+ * @brief Terminator of a free list.
+ */
+#define PORT_MEMORY_POOL_NIL ((port_memory_ref_t)-1)
+
+/**
+ * @brief Pool of fixed-size blocks within a single segment.
+ *
+ * Free blocks are linked with far references stored in their first units,
+ * so the list stays valid when the segment is relocated or mapped to a device buffer.
+ */
+typedef struct port_memory_pool {
+    port_memory_ref_format_t format; ///< Memory reference format.
+
+    port_memory_unit_t *memory; ///< Segment memory.
+    port_uint32_t tidx; ///< Memory table index of the segment.
+
+    size_t block_stride; ///< Distance between blocks in units.
+    size_t num_blocks; ///< Number of blocks.
+
+    port_memory_ref_t free_list; ///< Head of the global free list.
+    size_t num_free_blocks; ///< Number of blocks in the global free list.
+    atomic_flag lock; ///< Lock of the global free list.
+} port_memory_pool_t;
+
+/**
+ * @brief Thread-local cache of free pool blocks.
+ *
+ * Blocks are moved between a cache and the pool in batches.
+ * A cache must not be used by several threads concurrently.
+ */
+typedef struct port_memory_pool_cache {
+    port_memory_pool_t *pool; ///< Pool.
+
+    port_memory_ref_t free_list; ///< Head of the local free list.
+    size_t num_free_blocks; ///< Number of blocks in the local free list.
+    size_t batch_size; ///< Number of blocks moved at once.
+} port_memory_pool_cache_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_POOL_TYP_H_
@@ -0,0 +1,94 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Profiling of memory reference resolution.
+ *
+ * If PORT_FEATURE_MEMORY_PROFILE is defined, port_memory_at() and other
+ * resolution functions for generic memory record every resolution:
+ * port_memory_at(), port_memory_at_half(), port_memory_at_quarter() and their unit variants,
+ * port_memory_at_batch(), port_memory_follow_chain(),
+ * and functions defined with PORT_MEMORY_DEFINE_FORMAT().
+ *
+ * Not recorded are PORT_MEMORY_AT() and other macros, prefetches,
+ * port_memory_offset_batch(), and lookups done by the library itself
+ * (such as in port_memory_relocate() and port_memory_copy_remap()),
+ * so that the statistics reflect accesses of the workload only.
+ * Statistics are gathered per thread without synchronization,
+ * and are summed over all threads on request.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_PROFILE_FUN_H_
+#define _PORT_MEMORY_PROFILE_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/profile.typ.h"
+#include "port/memory.typ.h"
+#include "port/pointer.typ.h"
+
+#include <stdio.h>
+
+
+/**
+ * @brief Record memory reference resolution in statistics of the calling thread.
+ *
+ * Reuse distance is sampled by watching cache lines of every
+ * PORT_MEMORY_PROFILE_SAMPLE_PERIOD-th resolution target,
+ * and measured in number of resolutions done by the thread.
+ *
+ * @return Resolved pointer.
+ */
+port_const_void_ptr_t
+port_memory_profile_record(
+        port_memory_ref_t ref, ///< [in] Memory reference.
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+        port_const_void_ptr_t ptr ///< [in] Resolved pointer.
+);
+
+/**
+ * @brief Sum statistics of all threads.
+ *
+ * Counters of running threads are read without stopping them,
+ * so the result is a consistent snapshot of every counter, but not of the whole.
+ */
+void
+port_memory_profile_collect(
+        port_memory_profile_t *profile ///< [out] Statistics.
+);
+
+/**
+ * @brief Reset statistics of all threads.
+ */
+void
+port_memory_profile_reset(void);
+
+/**
+ * @brief Print report of statistics of all threads.
+ */
+void
+port_memory_profile_report(
+        FILE *file ///< [in] Output file.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_PROFILE_FUN_H_
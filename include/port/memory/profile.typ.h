@@ -0,0 +1,74 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for profiling of memory reference resolution.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_PROFILE_TYP_H_
+#define _PORT_MEMORY_PROFILE_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/types.typ.h"
+
+
+#ifndef PORT_MEMORY_PROFILE_NUM_TIDX
+/**
+ * @brief Number of table indices with separate hit counters.
+ */
+#  define PORT_MEMORY_PROFILE_NUM_TIDX 1024
+#endif
+
+#ifndef PORT_MEMORY_PROFILE_SAMPLE_PERIOD
+/**
+ * @brief Period of reuse distance sampling (in resolutions).
+ */
+#  define PORT_MEMORY_PROFILE_SAMPLE_PERIOD 64
+#endif
+
+/**
+ * @brief Number of buckets in log2 histograms.
+ *
+ * Bucket 0 counts zero values, bucket k counts values from [2^(k-1); 2^k).
+ */
+#define PORT_MEMORY_PROFILE_NUM_LOG2_BUCKETS 65
+
+/**
+ * @brief Statistics of memory reference resolution.
+ */
+typedef struct port_memory_profile {
+    port_uint64_t num_near; ///< Number of near reference resolutions.
+    port_uint64_t num_far; ///< Number of far reference resolutions.
+
+    port_uint64_t tidx_hits[PORT_MEMORY_PROFILE_NUM_TIDX]; ///< Far reference resolutions per table index.
+    port_uint64_t tidx_hits_other; ///< Far reference resolutions with larger table indices.
+
+    port_uint64_t near_offset_log2[PORT_MEMORY_PROFILE_NUM_LOG2_BUCKETS]; ///< Histogram of near byte offsets.
+    port_uint64_t far_offset_log2[PORT_MEMORY_PROFILE_NUM_LOG2_BUCKETS]; ///< Histogram of far byte offsets.
+
+    port_uint64_t num_reuse_samples; ///< Number of sampled cache lines that were reused.
+    port_uint64_t reuse_distance_log2[PORT_MEMORY_PROFILE_NUM_LOG2_BUCKETS]; ///< Histogram of reuse distances.
+} port_memory_profile_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_PROFILE_TYP_H_
@@ -28,6 +28,10 @@
 
 #include "port/pointer.typ.h"
 
+#ifdef PORT_FEATURE_INLINE
+#  include "port/memory/read.inl.h" // static inline definitions
+#endif
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for built-in types (generic address space)
@@ -811,6 +815,793 @@ port_float64_v16_t port_memory_read_constant_float64_v16(port_constant_void_ptr_
 
 #endif // __OPENCL_C_VERSION__
 
+///////////////////////////////////////////////////////////////////////////////
+// Unaligned access to built-in types (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Offsets of unaligned accesses are measured in bytes, memory has no alignment requirements.
+ * Vectors of 3 elements occupy 3 elements in memory.
+ */
+
+// Unsigned integer (8-bit)
+port_uint8_t port_memory_read_uint8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint8_v2_t port_memory_read_uint8_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint8_v3_t port_memory_read_uint8_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint8_v4_t port_memory_read_uint8_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint8_v8_t port_memory_read_uint8_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint8_v16_t port_memory_read_uint8_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Unsigned integer (16-bit)
+port_uint16_t port_memory_read_uint16_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint16_v2_t port_memory_read_uint16_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint16_v3_t port_memory_read_uint16_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint16_v4_t port_memory_read_uint16_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint16_v8_t port_memory_read_uint16_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint16_v16_t port_memory_read_uint16_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Unsigned integer (32-bit)
+port_uint32_t port_memory_read_uint32_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint32_v2_t port_memory_read_uint32_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint32_v3_t port_memory_read_uint32_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint32_v4_t port_memory_read_uint32_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint32_v8_t port_memory_read_uint32_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint32_v16_t port_memory_read_uint32_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Unsigned integer (64-bit)
+port_uint64_t port_memory_read_uint64_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint64_v2_t port_memory_read_uint64_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint64_v3_t port_memory_read_uint64_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint64_v4_t port_memory_read_uint64_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint64_v8_t port_memory_read_uint64_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_uint64_v16_t port_memory_read_uint64_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Signed integer (8-bit)
+port_sint8_t port_memory_read_sint8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint8_v2_t port_memory_read_sint8_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint8_v3_t port_memory_read_sint8_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint8_v4_t port_memory_read_sint8_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint8_v8_t port_memory_read_sint8_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint8_v16_t port_memory_read_sint8_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Signed integer (16-bit)
+port_sint16_t port_memory_read_sint16_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint16_v2_t port_memory_read_sint16_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint16_v3_t port_memory_read_sint16_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint16_v4_t port_memory_read_sint16_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint16_v8_t port_memory_read_sint16_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint16_v16_t port_memory_read_sint16_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Signed integer (32-bit)
+port_sint32_t port_memory_read_sint32_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint32_v2_t port_memory_read_sint32_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint32_v3_t port_memory_read_sint32_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint32_v4_t port_memory_read_sint32_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint32_v8_t port_memory_read_sint32_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint32_v16_t port_memory_read_sint32_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Signed integer (64-bit)
+port_sint64_t port_memory_read_sint64_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint64_v2_t port_memory_read_sint64_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint64_v3_t port_memory_read_sint64_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint64_v4_t port_memory_read_sint64_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint64_v8_t port_memory_read_sint64_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_sint64_v16_t port_memory_read_sint64_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Floating-point number (16-bit)
+port_float32_t port_memory_read_float16_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v2_t port_memory_read_float16_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v3_t port_memory_read_float16_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v4_t port_memory_read_float16_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v8_t port_memory_read_float16_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v16_t port_memory_read_float16_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Floating-point number (32-bit)
+port_float32_t port_memory_read_float32_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v2_t port_memory_read_float32_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v3_t port_memory_read_float32_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v4_t port_memory_read_float32_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v8_t port_memory_read_float32_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float32_v16_t port_memory_read_float32_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+// Floating-point number (64-bit)
+port_float64_t port_memory_read_float64_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float64_v2_t port_memory_read_float64_v2_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float64_v3_t port_memory_read_float64_v3_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float64_v4_t port_memory_read_float64_v4_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float64_v8_t port_memory_read_float64_v8_unaligned(port_const_void_ptr_t memory, size_t offset);
+port_float64_v16_t port_memory_read_float64_v16_unaligned(port_const_void_ptr_t memory, size_t offset);
+
+#ifdef __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Unaligned access to built-in types (named address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+// Unsigned integer (8-bit)
+port_uint8_t port_memory_read_local_uint8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint8_t port_memory_read_global_uint8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint8_t port_memory_read_constant_uint8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of unsigned integers (8-bit)
+port_uint8_v2_t port_memory_read_local_uint8_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint8_v2_t port_memory_read_global_uint8_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint8_v2_t port_memory_read_constant_uint8_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of unsigned integers (8-bit)
+port_uint8_v3_t port_memory_read_local_uint8_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint8_v3_t port_memory_read_global_uint8_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint8_v3_t port_memory_read_constant_uint8_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of unsigned integers (8-bit)
+port_uint8_v4_t port_memory_read_local_uint8_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint8_v4_t port_memory_read_global_uint8_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint8_v4_t port_memory_read_constant_uint8_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of unsigned integers (8-bit)
+port_uint8_v8_t port_memory_read_local_uint8_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint8_v8_t port_memory_read_global_uint8_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint8_v8_t port_memory_read_constant_uint8_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of unsigned integers (8-bit)
+port_uint8_v16_t port_memory_read_local_uint8_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint8_v16_t port_memory_read_global_uint8_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint8_v16_t port_memory_read_constant_uint8_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Unsigned integer (16-bit)
+port_uint16_t port_memory_read_local_uint16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint16_t port_memory_read_global_uint16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint16_t port_memory_read_constant_uint16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of unsigned integers (16-bit)
+port_uint16_v2_t port_memory_read_local_uint16_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint16_v2_t port_memory_read_global_uint16_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint16_v2_t port_memory_read_constant_uint16_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of unsigned integers (16-bit)
+port_uint16_v3_t port_memory_read_local_uint16_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint16_v3_t port_memory_read_global_uint16_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint16_v3_t port_memory_read_constant_uint16_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of unsigned integers (16-bit)
+port_uint16_v4_t port_memory_read_local_uint16_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint16_v4_t port_memory_read_global_uint16_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint16_v4_t port_memory_read_constant_uint16_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of unsigned integers (16-bit)
+port_uint16_v8_t port_memory_read_local_uint16_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint16_v8_t port_memory_read_global_uint16_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint16_v8_t port_memory_read_constant_uint16_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of unsigned integers (16-bit)
+port_uint16_v16_t port_memory_read_local_uint16_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint16_v16_t port_memory_read_global_uint16_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint16_v16_t port_memory_read_constant_uint16_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Unsigned integer (32-bit)
+port_uint32_t port_memory_read_local_uint32_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint32_t port_memory_read_global_uint32_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint32_t port_memory_read_constant_uint32_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of unsigned integers (32-bit)
+port_uint32_v2_t port_memory_read_local_uint32_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint32_v2_t port_memory_read_global_uint32_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint32_v2_t port_memory_read_constant_uint32_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of unsigned integers (32-bit)
+port_uint32_v3_t port_memory_read_local_uint32_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint32_v3_t port_memory_read_global_uint32_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint32_v3_t port_memory_read_constant_uint32_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of unsigned integers (32-bit)
+port_uint32_v4_t port_memory_read_local_uint32_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint32_v4_t port_memory_read_global_uint32_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint32_v4_t port_memory_read_constant_uint32_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of unsigned integers (32-bit)
+port_uint32_v8_t port_memory_read_local_uint32_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint32_v8_t port_memory_read_global_uint32_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint32_v8_t port_memory_read_constant_uint32_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of unsigned integers (32-bit)
+port_uint32_v16_t port_memory_read_local_uint32_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint32_v16_t port_memory_read_global_uint32_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint32_v16_t port_memory_read_constant_uint32_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Unsigned integer (64-bit)
+port_uint64_t port_memory_read_local_uint64_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint64_t port_memory_read_global_uint64_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint64_t port_memory_read_constant_uint64_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of unsigned integers (64-bit)
+port_uint64_v2_t port_memory_read_local_uint64_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint64_v2_t port_memory_read_global_uint64_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint64_v2_t port_memory_read_constant_uint64_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of unsigned integers (64-bit)
+port_uint64_v3_t port_memory_read_local_uint64_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint64_v3_t port_memory_read_global_uint64_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint64_v3_t port_memory_read_constant_uint64_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of unsigned integers (64-bit)
+port_uint64_v4_t port_memory_read_local_uint64_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint64_v4_t port_memory_read_global_uint64_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint64_v4_t port_memory_read_constant_uint64_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of unsigned integers (64-bit)
+port_uint64_v8_t port_memory_read_local_uint64_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint64_v8_t port_memory_read_global_uint64_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint64_v8_t port_memory_read_constant_uint64_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of unsigned integers (64-bit)
+port_uint64_v16_t port_memory_read_local_uint64_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_uint64_v16_t port_memory_read_global_uint64_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_uint64_v16_t port_memory_read_constant_uint64_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Signed integer (8-bit)
+port_sint8_t port_memory_read_local_sint8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint8_t port_memory_read_global_sint8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint8_t port_memory_read_constant_sint8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of signed integers (8-bit)
+port_sint8_v2_t port_memory_read_local_sint8_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint8_v2_t port_memory_read_global_sint8_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint8_v2_t port_memory_read_constant_sint8_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of signed integers (8-bit)
+port_sint8_v3_t port_memory_read_local_sint8_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint8_v3_t port_memory_read_global_sint8_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint8_v3_t port_memory_read_constant_sint8_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of signed integers (8-bit)
+port_sint8_v4_t port_memory_read_local_sint8_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint8_v4_t port_memory_read_global_sint8_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint8_v4_t port_memory_read_constant_sint8_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of signed integers (8-bit)
+port_sint8_v8_t port_memory_read_local_sint8_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint8_v8_t port_memory_read_global_sint8_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint8_v8_t port_memory_read_constant_sint8_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of signed integers (8-bit)
+port_sint8_v16_t port_memory_read_local_sint8_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint8_v16_t port_memory_read_global_sint8_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint8_v16_t port_memory_read_constant_sint8_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Signed integer (16-bit)
+port_sint16_t port_memory_read_local_sint16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint16_t port_memory_read_global_sint16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint16_t port_memory_read_constant_sint16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of signed integers (16-bit)
+port_sint16_v2_t port_memory_read_local_sint16_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint16_v2_t port_memory_read_global_sint16_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint16_v2_t port_memory_read_constant_sint16_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of signed integers (16-bit)
+port_sint16_v3_t port_memory_read_local_sint16_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint16_v3_t port_memory_read_global_sint16_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint16_v3_t port_memory_read_constant_sint16_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of signed integers (16-bit)
+port_sint16_v4_t port_memory_read_local_sint16_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint16_v4_t port_memory_read_global_sint16_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint16_v4_t port_memory_read_constant_sint16_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of signed integers (16-bit)
+port_sint16_v8_t port_memory_read_local_sint16_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint16_v8_t port_memory_read_global_sint16_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint16_v8_t port_memory_read_constant_sint16_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of signed integers (16-bit)
+port_sint16_v16_t port_memory_read_local_sint16_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint16_v16_t port_memory_read_global_sint16_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint16_v16_t port_memory_read_constant_sint16_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Signed integer (32-bit)
+port_sint32_t port_memory_read_local_sint32_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint32_t port_memory_read_global_sint32_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint32_t port_memory_read_constant_sint32_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of signed integers (32-bit)
+port_sint32_v2_t port_memory_read_local_sint32_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint32_v2_t port_memory_read_global_sint32_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint32_v2_t port_memory_read_constant_sint32_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of signed integers (32-bit)
+port_sint32_v3_t port_memory_read_local_sint32_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint32_v3_t port_memory_read_global_sint32_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint32_v3_t port_memory_read_constant_sint32_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of signed integers (32-bit)
+port_sint32_v4_t port_memory_read_local_sint32_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint32_v4_t port_memory_read_global_sint32_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint32_v4_t port_memory_read_constant_sint32_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of signed integers (32-bit)
+port_sint32_v8_t port_memory_read_local_sint32_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint32_v8_t port_memory_read_global_sint32_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint32_v8_t port_memory_read_constant_sint32_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of signed integers (32-bit)
+port_sint32_v16_t port_memory_read_local_sint32_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint32_v16_t port_memory_read_global_sint32_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint32_v16_t port_memory_read_constant_sint32_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Signed integer (64-bit)
+port_sint64_t port_memory_read_local_sint64_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint64_t port_memory_read_global_sint64_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint64_t port_memory_read_constant_sint64_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of signed integers (64-bit)
+port_sint64_v2_t port_memory_read_local_sint64_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint64_v2_t port_memory_read_global_sint64_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint64_v2_t port_memory_read_constant_sint64_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of signed integers (64-bit)
+port_sint64_v3_t port_memory_read_local_sint64_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint64_v3_t port_memory_read_global_sint64_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint64_v3_t port_memory_read_constant_sint64_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of signed integers (64-bit)
+port_sint64_v4_t port_memory_read_local_sint64_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint64_v4_t port_memory_read_global_sint64_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint64_v4_t port_memory_read_constant_sint64_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of signed integers (64-bit)
+port_sint64_v8_t port_memory_read_local_sint64_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint64_v8_t port_memory_read_global_sint64_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint64_v8_t port_memory_read_constant_sint64_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of signed integers (64-bit)
+port_sint64_v16_t port_memory_read_local_sint64_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_sint64_v16_t port_memory_read_global_sint64_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_sint64_v16_t port_memory_read_constant_sint64_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Floating-point number (16-bit)
+port_float32_t port_memory_read_local_float16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_t port_memory_read_global_float16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_t port_memory_read_constant_float16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of floating-point numbers (16-bit)
+port_float32_v2_t port_memory_read_local_float16_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v2_t port_memory_read_global_float16_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v2_t port_memory_read_constant_float16_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of floating-point numbers (16-bit)
+port_float32_v3_t port_memory_read_local_float16_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v3_t port_memory_read_global_float16_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v3_t port_memory_read_constant_float16_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of floating-point numbers (16-bit)
+port_float32_v4_t port_memory_read_local_float16_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v4_t port_memory_read_global_float16_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v4_t port_memory_read_constant_float16_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of floating-point numbers (16-bit)
+port_float32_v8_t port_memory_read_local_float16_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v8_t port_memory_read_global_float16_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v8_t port_memory_read_constant_float16_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of floating-point numbers (16-bit)
+port_float32_v16_t port_memory_read_local_float16_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v16_t port_memory_read_global_float16_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v16_t port_memory_read_constant_float16_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Floating-point number (32-bit)
+port_float32_t port_memory_read_local_float32_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_t port_memory_read_global_float32_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_t port_memory_read_constant_float32_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of floating-point numbers (32-bit)
+port_float32_v2_t port_memory_read_local_float32_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v2_t port_memory_read_global_float32_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v2_t port_memory_read_constant_float32_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of floating-point numbers (32-bit)
+port_float32_v3_t port_memory_read_local_float32_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v3_t port_memory_read_global_float32_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v3_t port_memory_read_constant_float32_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of floating-point numbers (32-bit)
+port_float32_v4_t port_memory_read_local_float32_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v4_t port_memory_read_global_float32_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v4_t port_memory_read_constant_float32_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of floating-point numbers (32-bit)
+port_float32_v8_t port_memory_read_local_float32_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v8_t port_memory_read_global_float32_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v8_t port_memory_read_constant_float32_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of floating-point numbers (32-bit)
+port_float32_v16_t port_memory_read_local_float32_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float32_v16_t port_memory_read_global_float32_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float32_v16_t port_memory_read_constant_float32_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+
+// Floating-point number (64-bit)
+port_float64_t port_memory_read_local_float64_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float64_t port_memory_read_global_float64_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float64_t port_memory_read_constant_float64_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 2-vector of floating-point numbers (64-bit)
+port_float64_v2_t port_memory_read_local_float64_v2_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float64_v2_t port_memory_read_global_float64_v2_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float64_v2_t port_memory_read_constant_float64_v2_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 3-vector of floating-point numbers (64-bit)
+port_float64_v3_t port_memory_read_local_float64_v3_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float64_v3_t port_memory_read_global_float64_v3_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float64_v3_t port_memory_read_constant_float64_v3_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 4-vector of floating-point numbers (64-bit)
+port_float64_v4_t port_memory_read_local_float64_v4_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float64_v4_t port_memory_read_global_float64_v4_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float64_v4_t port_memory_read_constant_float64_v4_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 8-vector of floating-point numbers (64-bit)
+port_float64_v8_t port_memory_read_local_float64_v8_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float64_v8_t port_memory_read_global_float64_v8_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float64_v8_t port_memory_read_constant_float64_v8_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+// 16-vector of floating-point numbers (64-bit)
+port_float64_v16_t port_memory_read_local_float64_v16_unaligned(port_const_local_void_ptr_t memory, size_t offset);
+port_float64_v16_t port_memory_read_global_float64_v16_unaligned(port_const_global_void_ptr_t memory, size_t offset);
+port_float64_v16_t port_memory_read_constant_float64_v16_unaligned(port_constant_void_ptr_t memory, size_t offset);
+
+#else // __OPENCL_C_VERSION__
+
+// Unsigned integer (8-bit)
+#  define port_memory_read_local_uint8_unaligned              port_memory_read_uint8_unaligned
+#  define port_memory_read_global_uint8_unaligned             port_memory_read_uint8_unaligned
+#  define port_memory_read_constant_uint8_unaligned           port_memory_read_uint8_unaligned
+
+// 2-vector of unsigned integers (8-bit)
+#  define port_memory_read_local_uint8_v2_unaligned           port_memory_read_uint8_v2_unaligned
+#  define port_memory_read_global_uint8_v2_unaligned          port_memory_read_uint8_v2_unaligned
+#  define port_memory_read_constant_uint8_v2_unaligned        port_memory_read_uint8_v2_unaligned
+
+// 3-vector of unsigned integers (8-bit)
+#  define port_memory_read_local_uint8_v3_unaligned           port_memory_read_uint8_v3_unaligned
+#  define port_memory_read_global_uint8_v3_unaligned          port_memory_read_uint8_v3_unaligned
+#  define port_memory_read_constant_uint8_v3_unaligned        port_memory_read_uint8_v3_unaligned
+
+// 4-vector of unsigned integers (8-bit)
+#  define port_memory_read_local_uint8_v4_unaligned           port_memory_read_uint8_v4_unaligned
+#  define port_memory_read_global_uint8_v4_unaligned          port_memory_read_uint8_v4_unaligned
+#  define port_memory_read_constant_uint8_v4_unaligned        port_memory_read_uint8_v4_unaligned
+
+// 8-vector of unsigned integers (8-bit)
+#  define port_memory_read_local_uint8_v8_unaligned           port_memory_read_uint8_v8_unaligned
+#  define port_memory_read_global_uint8_v8_unaligned          port_memory_read_uint8_v8_unaligned
+#  define port_memory_read_constant_uint8_v8_unaligned        port_memory_read_uint8_v8_unaligned
+
+// 16-vector of unsigned integers (8-bit)
+#  define port_memory_read_local_uint8_v16_unaligned          port_memory_read_uint8_v16_unaligned
+#  define port_memory_read_global_uint8_v16_unaligned         port_memory_read_uint8_v16_unaligned
+#  define port_memory_read_constant_uint8_v16_unaligned       port_memory_read_uint8_v16_unaligned
+
+
+// Unsigned integer (16-bit)
+#  define port_memory_read_local_uint16_unaligned             port_memory_read_uint16_unaligned
+#  define port_memory_read_global_uint16_unaligned            port_memory_read_uint16_unaligned
+#  define port_memory_read_constant_uint16_unaligned          port_memory_read_uint16_unaligned
+
+// 2-vector of unsigned integers (16-bit)
+#  define port_memory_read_local_uint16_v2_unaligned          port_memory_read_uint16_v2_unaligned
+#  define port_memory_read_global_uint16_v2_unaligned         port_memory_read_uint16_v2_unaligned
+#  define port_memory_read_constant_uint16_v2_unaligned       port_memory_read_uint16_v2_unaligned
+
+// 3-vector of unsigned integers (16-bit)
+#  define port_memory_read_local_uint16_v3_unaligned          port_memory_read_uint16_v3_unaligned
+#  define port_memory_read_global_uint16_v3_unaligned         port_memory_read_uint16_v3_unaligned
+#  define port_memory_read_constant_uint16_v3_unaligned       port_memory_read_uint16_v3_unaligned
+
+// 4-vector of unsigned integers (16-bit)
+#  define port_memory_read_local_uint16_v4_unaligned          port_memory_read_uint16_v4_unaligned
+#  define port_memory_read_global_uint16_v4_unaligned         port_memory_read_uint16_v4_unaligned
+#  define port_memory_read_constant_uint16_v4_unaligned       port_memory_read_uint16_v4_unaligned
+
+// 8-vector of unsigned integers (16-bit)
+#  define port_memory_read_local_uint16_v8_unaligned          port_memory_read_uint16_v8_unaligned
+#  define port_memory_read_global_uint16_v8_unaligned         port_memory_read_uint16_v8_unaligned
+#  define port_memory_read_constant_uint16_v8_unaligned       port_memory_read_uint16_v8_unaligned
+
+// 16-vector of unsigned integers (16-bit)
+#  define port_memory_read_local_uint16_v16_unaligned         port_memory_read_uint16_v16_unaligned
+#  define port_memory_read_global_uint16_v16_unaligned        port_memory_read_uint16_v16_unaligned
+#  define port_memory_read_constant_uint16_v16_unaligned      port_memory_read_uint16_v16_unaligned
+
+
+// Unsigned integer (32-bit)
+#  define port_memory_read_local_uint32_unaligned             port_memory_read_uint32_unaligned
+#  define port_memory_read_global_uint32_unaligned            port_memory_read_uint32_unaligned
+#  define port_memory_read_constant_uint32_unaligned          port_memory_read_uint32_unaligned
+
+// 2-vector of unsigned integers (32-bit)
+#  define port_memory_read_local_uint32_v2_unaligned          port_memory_read_uint32_v2_unaligned
+#  define port_memory_read_global_uint32_v2_unaligned         port_memory_read_uint32_v2_unaligned
+#  define port_memory_read_constant_uint32_v2_unaligned       port_memory_read_uint32_v2_unaligned
+
+// 3-vector of unsigned integers (32-bit)
+#  define port_memory_read_local_uint32_v3_unaligned          port_memory_read_uint32_v3_unaligned
+#  define port_memory_read_global_uint32_v3_unaligned         port_memory_read_uint32_v3_unaligned
+#  define port_memory_read_constant_uint32_v3_unaligned       port_memory_read_uint32_v3_unaligned
+
+// 4-vector of unsigned integers (32-bit)
+#  define port_memory_read_local_uint32_v4_unaligned          port_memory_read_uint32_v4_unaligned
+#  define port_memory_read_global_uint32_v4_unaligned         port_memory_read_uint32_v4_unaligned
+#  define port_memory_read_constant_uint32_v4_unaligned       port_memory_read_uint32_v4_unaligned
+
+// 8-vector of unsigned integers (32-bit)
+#  define port_memory_read_local_uint32_v8_unaligned          port_memory_read_uint32_v8_unaligned
+#  define port_memory_read_global_uint32_v8_unaligned         port_memory_read_uint32_v8_unaligned
+#  define port_memory_read_constant_uint32_v8_unaligned       port_memory_read_uint32_v8_unaligned
+
+// 16-vector of unsigned integers (32-bit)
+#  define port_memory_read_local_uint32_v16_unaligned         port_memory_read_uint32_v16_unaligned
+#  define port_memory_read_global_uint32_v16_unaligned        port_memory_read_uint32_v16_unaligned
+#  define port_memory_read_constant_uint32_v16_unaligned      port_memory_read_uint32_v16_unaligned
+
+
+// Unsigned integer (64-bit)
+#  define port_memory_read_local_uint64_unaligned             port_memory_read_uint64_unaligned
+#  define port_memory_read_global_uint64_unaligned            port_memory_read_uint64_unaligned
+#  define port_memory_read_constant_uint64_unaligned          port_memory_read_uint64_unaligned
+
+// 2-vector of unsigned integers (64-bit)
+#  define port_memory_read_local_uint64_v2_unaligned          port_memory_read_uint64_v2_unaligned
+#  define port_memory_read_global_uint64_v2_unaligned         port_memory_read_uint64_v2_unaligned
+#  define port_memory_read_constant_uint64_v2_unaligned       port_memory_read_uint64_v2_unaligned
+
+// 3-vector of unsigned integers (64-bit)
+#  define port_memory_read_local_uint64_v3_unaligned          port_memory_read_uint64_v3_unaligned
+#  define port_memory_read_global_uint64_v3_unaligned         port_memory_read_uint64_v3_unaligned
+#  define port_memory_read_constant_uint64_v3_unaligned       port_memory_read_uint64_v3_unaligned
+
+// 4-vector of unsigned integers (64-bit)
+#  define port_memory_read_local_uint64_v4_unaligned          port_memory_read_uint64_v4_unaligned
+#  define port_memory_read_global_uint64_v4_unaligned         port_memory_read_uint64_v4_unaligned
+#  define port_memory_read_constant_uint64_v4_unaligned       port_memory_read_uint64_v4_unaligned
+
+// 8-vector of unsigned integers (64-bit)
+#  define port_memory_read_local_uint64_v8_unaligned          port_memory_read_uint64_v8_unaligned
+#  define port_memory_read_global_uint64_v8_unaligned         port_memory_read_uint64_v8_unaligned
+#  define port_memory_read_constant_uint64_v8_unaligned       port_memory_read_uint64_v8_unaligned
+
+// 16-vector of unsigned integers (64-bit)
+#  define port_memory_read_local_uint64_v16_unaligned         port_memory_read_uint64_v16_unaligned
+#  define port_memory_read_global_uint64_v16_unaligned        port_memory_read_uint64_v16_unaligned
+#  define port_memory_read_constant_uint64_v16_unaligned      port_memory_read_uint64_v16_unaligned
+
+
+// Signed integer (8-bit)
+#  define port_memory_read_local_sint8_unaligned              port_memory_read_sint8_unaligned
+#  define port_memory_read_global_sint8_unaligned             port_memory_read_sint8_unaligned
+#  define port_memory_read_constant_sint8_unaligned           port_memory_read_sint8_unaligned
+
+// 2-vector of signed integers (8-bit)
+#  define port_memory_read_local_sint8_v2_unaligned           port_memory_read_sint8_v2_unaligned
+#  define port_memory_read_global_sint8_v2_unaligned          port_memory_read_sint8_v2_unaligned
+#  define port_memory_read_constant_sint8_v2_unaligned        port_memory_read_sint8_v2_unaligned
+
+// 3-vector of signed integers (8-bit)
+#  define port_memory_read_local_sint8_v3_unaligned           port_memory_read_sint8_v3_unaligned
+#  define port_memory_read_global_sint8_v3_unaligned          port_memory_read_sint8_v3_unaligned
+#  define port_memory_read_constant_sint8_v3_unaligned        port_memory_read_sint8_v3_unaligned
+
+// 4-vector of signed integers (8-bit)
+#  define port_memory_read_local_sint8_v4_unaligned           port_memory_read_sint8_v4_unaligned
+#  define port_memory_read_global_sint8_v4_unaligned          port_memory_read_sint8_v4_unaligned
+#  define port_memory_read_constant_sint8_v4_unaligned        port_memory_read_sint8_v4_unaligned
+
+// 8-vector of signed integers (8-bit)
+#  define port_memory_read_local_sint8_v8_unaligned           port_memory_read_sint8_v8_unaligned
+#  define port_memory_read_global_sint8_v8_unaligned          port_memory_read_sint8_v8_unaligned
+#  define port_memory_read_constant_sint8_v8_unaligned        port_memory_read_sint8_v8_unaligned
+
+// 16-vector of signed integers (8-bit)
+#  define port_memory_read_local_sint8_v16_unaligned          port_memory_read_sint8_v16_unaligned
+#  define port_memory_read_global_sint8_v16_unaligned         port_memory_read_sint8_v16_unaligned
+#  define port_memory_read_constant_sint8_v16_unaligned       port_memory_read_sint8_v16_unaligned
+
+
+// Signed integer (16-bit)
+#  define port_memory_read_local_sint16_unaligned             port_memory_read_sint16_unaligned
+#  define port_memory_read_global_sint16_unaligned            port_memory_read_sint16_unaligned
+#  define port_memory_read_constant_sint16_unaligned          port_memory_read_sint16_unaligned
+
+// 2-vector of signed integers (16-bit)
+#  define port_memory_read_local_sint16_v2_unaligned          port_memory_read_sint16_v2_unaligned
+#  define port_memory_read_global_sint16_v2_unaligned         port_memory_read_sint16_v2_unaligned
+#  define port_memory_read_constant_sint16_v2_unaligned       port_memory_read_sint16_v2_unaligned
+
+// 3-vector of signed integers (16-bit)
+#  define port_memory_read_local_sint16_v3_unaligned          port_memory_read_sint16_v3_unaligned
+#  define port_memory_read_global_sint16_v3_unaligned         port_memory_read_sint16_v3_unaligned
+#  define port_memory_read_constant_sint16_v3_unaligned       port_memory_read_sint16_v3_unaligned
+
+// 4-vector of signed integers (16-bit)
+#  define port_memory_read_local_sint16_v4_unaligned          port_memory_read_sint16_v4_unaligned
+#  define port_memory_read_global_sint16_v4_unaligned         port_memory_read_sint16_v4_unaligned
+#  define port_memory_read_constant_sint16_v4_unaligned       port_memory_read_sint16_v4_unaligned
+
+// 8-vector of signed integers (16-bit)
+#  define port_memory_read_local_sint16_v8_unaligned          port_memory_read_sint16_v8_unaligned
+#  define port_memory_read_global_sint16_v8_unaligned         port_memory_read_sint16_v8_unaligned
+#  define port_memory_read_constant_sint16_v8_unaligned       port_memory_read_sint16_v8_unaligned
+
+// 16-vector of signed integers (16-bit)
+#  define port_memory_read_local_sint16_v16_unaligned         port_memory_read_sint16_v16_unaligned
+#  define port_memory_read_global_sint16_v16_unaligned        port_memory_read_sint16_v16_unaligned
+#  define port_memory_read_constant_sint16_v16_unaligned      port_memory_read_sint16_v16_unaligned
+
+
+// Signed integer (32-bit)
+#  define port_memory_read_local_sint32_unaligned             port_memory_read_sint32_unaligned
+#  define port_memory_read_global_sint32_unaligned            port_memory_read_sint32_unaligned
+#  define port_memory_read_constant_sint32_unaligned          port_memory_read_sint32_unaligned
+
+// 2-vector of signed integers (32-bit)
+#  define port_memory_read_local_sint32_v2_unaligned          port_memory_read_sint32_v2_unaligned
+#  define port_memory_read_global_sint32_v2_unaligned         port_memory_read_sint32_v2_unaligned
+#  define port_memory_read_constant_sint32_v2_unaligned       port_memory_read_sint32_v2_unaligned
+
+// 3-vector of signed integers (32-bit)
+#  define port_memory_read_local_sint32_v3_unaligned          port_memory_read_sint32_v3_unaligned
+#  define port_memory_read_global_sint32_v3_unaligned         port_memory_read_sint32_v3_unaligned
+#  define port_memory_read_constant_sint32_v3_unaligned       port_memory_read_sint32_v3_unaligned
+
+// 4-vector of signed integers (32-bit)
+#  define port_memory_read_local_sint32_v4_unaligned          port_memory_read_sint32_v4_unaligned
+#  define port_memory_read_global_sint32_v4_unaligned         port_memory_read_sint32_v4_unaligned
+#  define port_memory_read_constant_sint32_v4_unaligned       port_memory_read_sint32_v4_unaligned
+
+// 8-vector of signed integers (32-bit)
+#  define port_memory_read_local_sint32_v8_unaligned          port_memory_read_sint32_v8_unaligned
+#  define port_memory_read_global_sint32_v8_unaligned         port_memory_read_sint32_v8_unaligned
+#  define port_memory_read_constant_sint32_v8_unaligned       port_memory_read_sint32_v8_unaligned
+
+// 16-vector of signed integers (32-bit)
+#  define port_memory_read_local_sint32_v16_unaligned         port_memory_read_sint32_v16_unaligned
+#  define port_memory_read_global_sint32_v16_unaligned        port_memory_read_sint32_v16_unaligned
+#  define port_memory_read_constant_sint32_v16_unaligned      port_memory_read_sint32_v16_unaligned
+
+
+// Signed integer (64-bit)
+#  define port_memory_read_local_sint64_unaligned             port_memory_read_sint64_unaligned
+#  define port_memory_read_global_sint64_unaligned            port_memory_read_sint64_unaligned
+#  define port_memory_read_constant_sint64_unaligned          port_memory_read_sint64_unaligned
+
+// 2-vector of signed integers (64-bit)
+#  define port_memory_read_local_sint64_v2_unaligned          port_memory_read_sint64_v2_unaligned
+#  define port_memory_read_global_sint64_v2_unaligned         port_memory_read_sint64_v2_unaligned
+#  define port_memory_read_constant_sint64_v2_unaligned       port_memory_read_sint64_v2_unaligned
+
+// 3-vector of signed integers (64-bit)
+#  define port_memory_read_local_sint64_v3_unaligned          port_memory_read_sint64_v3_unaligned
+#  define port_memory_read_global_sint64_v3_unaligned         port_memory_read_sint64_v3_unaligned
+#  define port_memory_read_constant_sint64_v3_unaligned       port_memory_read_sint64_v3_unaligned
+
+// 4-vector of signed integers (64-bit)
+#  define port_memory_read_local_sint64_v4_unaligned          port_memory_read_sint64_v4_unaligned
+#  define port_memory_read_global_sint64_v4_unaligned         port_memory_read_sint64_v4_unaligned
+#  define port_memory_read_constant_sint64_v4_unaligned       port_memory_read_sint64_v4_unaligned
+
+// 8-vector of signed integers (64-bit)
+#  define port_memory_read_local_sint64_v8_unaligned          port_memory_read_sint64_v8_unaligned
+#  define port_memory_read_global_sint64_v8_unaligned         port_memory_read_sint64_v8_unaligned
+#  define port_memory_read_constant_sint64_v8_unaligned       port_memory_read_sint64_v8_unaligned
+
+// 16-vector of signed integers (64-bit)
+#  define port_memory_read_local_sint64_v16_unaligned         port_memory_read_sint64_v16_unaligned
+#  define port_memory_read_global_sint64_v16_unaligned        port_memory_read_sint64_v16_unaligned
+#  define port_memory_read_constant_sint64_v16_unaligned      port_memory_read_sint64_v16_unaligned
+
+
+// Floating-point number (16-bit)
+#  define port_memory_read_local_float16_unaligned            port_memory_read_float16_unaligned
+#  define port_memory_read_global_float16_unaligned           port_memory_read_float16_unaligned
+#  define port_memory_read_constant_float16_unaligned         port_memory_read_float16_unaligned
+
+// 2-vector of floating-point numbers (16-bit)
+#  define port_memory_read_local_float16_v2_unaligned         port_memory_read_float16_v2_unaligned
+#  define port_memory_read_global_float16_v2_unaligned        port_memory_read_float16_v2_unaligned
+#  define port_memory_read_constant_float16_v2_unaligned      port_memory_read_float16_v2_unaligned
+
+// 3-vector of floating-point numbers (16-bit)
+#  define port_memory_read_local_float16_v3_unaligned         port_memory_read_float16_v3_unaligned
+#  define port_memory_read_global_float16_v3_unaligned        port_memory_read_float16_v3_unaligned
+#  define port_memory_read_constant_float16_v3_unaligned      port_memory_read_float16_v3_unaligned
+
+// 4-vector of floating-point numbers (16-bit)
+#  define port_memory_read_local_float16_v4_unaligned         port_memory_read_float16_v4_unaligned
+#  define port_memory_read_global_float16_v4_unaligned        port_memory_read_float16_v4_unaligned
+#  define port_memory_read_constant_float16_v4_unaligned      port_memory_read_float16_v4_unaligned
+
+// 8-vector of floating-point numbers (16-bit)
+#  define port_memory_read_local_float16_v8_unaligned         port_memory_read_float16_v8_unaligned
+#  define port_memory_read_global_float16_v8_unaligned        port_memory_read_float16_v8_unaligned
+#  define port_memory_read_constant_float16_v8_unaligned      port_memory_read_float16_v8_unaligned
+
+// 16-vector of floating-point numbers (16-bit)
+#  define port_memory_read_local_float16_v16_unaligned        port_memory_read_float16_v16_unaligned
+#  define port_memory_read_global_float16_v16_unaligned       port_memory_read_float16_v16_unaligned
+#  define port_memory_read_constant_float16_v16_unaligned     port_memory_read_float16_v16_unaligned
+
+
+// Floating-point number (32-bit)
+#  define port_memory_read_local_float32_unaligned            port_memory_read_float32_unaligned
+#  define port_memory_read_global_float32_unaligned           port_memory_read_float32_unaligned
+#  define port_memory_read_constant_float32_unaligned         port_memory_read_float32_unaligned
+
+// 2-vector of floating-point numbers (32-bit)
+#  define port_memory_read_local_float32_v2_unaligned         port_memory_read_float32_v2_unaligned
+#  define port_memory_read_global_float32_v2_unaligned        port_memory_read_float32_v2_unaligned
+#  define port_memory_read_constant_float32_v2_unaligned      port_memory_read_float32_v2_unaligned
+
+// 3-vector of floating-point numbers (32-bit)
+#  define port_memory_read_local_float32_v3_unaligned         port_memory_read_float32_v3_unaligned
+#  define port_memory_read_global_float32_v3_unaligned        port_memory_read_float32_v3_unaligned
+#  define port_memory_read_constant_float32_v3_unaligned      port_memory_read_float32_v3_unaligned
+
+// 4-vector of floating-point numbers (32-bit)
+#  define port_memory_read_local_float32_v4_unaligned         port_memory_read_float32_v4_unaligned
+#  define port_memory_read_global_float32_v4_unaligned        port_memory_read_float32_v4_unaligned
+#  define port_memory_read_constant_float32_v4_unaligned      port_memory_read_float32_v4_unaligned
+
+// 8-vector of floating-point numbers (32-bit)
+#  define port_memory_read_local_float32_v8_unaligned         port_memory_read_float32_v8_unaligned
+#  define port_memory_read_global_float32_v8_unaligned        port_memory_read_float32_v8_unaligned
+#  define port_memory_read_constant_float32_v8_unaligned      port_memory_read_float32_v8_unaligned
+
+// 16-vector of floating-point numbers (32-bit)
+#  define port_memory_read_local_float32_v16_unaligned        port_memory_read_float32_v16_unaligned
+#  define port_memory_read_global_float32_v16_unaligned       port_memory_read_float32_v16_unaligned
+#  define port_memory_read_constant_float32_v16_unaligned     port_memory_read_float32_v16_unaligned
+
+
+// Floating-point number (64-bit)
+#  define port_memory_read_local_float64_unaligned            port_memory_read_float64_unaligned
+#  define port_memory_read_global_float64_unaligned           port_memory_read_float64_unaligned
+#  define port_memory_read_constant_float64_unaligned         port_memory_read_float64_unaligned
+
+// 2-vector of floating-point numbers (64-bit)
+#  define port_memory_read_local_float64_v2_unaligned         port_memory_read_float64_v2_unaligned
+#  define port_memory_read_global_float64_v2_unaligned        port_memory_read_float64_v2_unaligned
+#  define port_memory_read_constant_float64_v2_unaligned      port_memory_read_float64_v2_unaligned
+
+// 3-vector of floating-point numbers (64-bit)
+#  define port_memory_read_local_float64_v3_unaligned         port_memory_read_float64_v3_unaligned
+#  define port_memory_read_global_float64_v3_unaligned        port_memory_read_float64_v3_unaligned
+#  define port_memory_read_constant_float64_v3_unaligned      port_memory_read_float64_v3_unaligned
+
+// 4-vector of floating-point numbers (64-bit)
+#  define port_memory_read_local_float64_v4_unaligned         port_memory_read_float64_v4_unaligned
+#  define port_memory_read_global_float64_v4_unaligned        port_memory_read_float64_v4_unaligned
+#  define port_memory_read_constant_float64_v4_unaligned      port_memory_read_float64_v4_unaligned
+
+// 8-vector of floating-point numbers (64-bit)
+#  define port_memory_read_local_float64_v8_unaligned         port_memory_read_float64_v8_unaligned
+#  define port_memory_read_global_float64_v8_unaligned        port_memory_read_float64_v8_unaligned
+#  define port_memory_read_constant_float64_v8_unaligned      port_memory_read_float64_v8_unaligned
+
+// 16-vector of floating-point numbers (64-bit)
+#  define port_memory_read_local_float64_v16_unaligned        port_memory_read_float64_v16_unaligned
+#  define port_memory_read_global_float64_v16_unaligned       port_memory_read_float64_v16_unaligned
+#  define port_memory_read_constant_float64_v16_unaligned     port_memory_read_float64_v16_unaligned
+
+#endif // __OPENCL_C_VERSION__
+
 ///////////////////////////////////////////////////////////////////////////////
 // Aliases for typedefs of built-in types
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,387 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Definitions of functions for reading built-in types from memory.
+ *
+ * Definitions are compiled into the library by default.
+ * If PORT_FEATURE_INLINE is defined, they are included by the corresponding
+ * .fun.h header as static inline functions instead.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_READ_INL_H_
+#define _PORT_MEMORY_READ_INL_H_
+
+#include "port/pointer.typ.h"
+
+#ifndef __OPENCL_C_VERSION__
+#  include "port/float.fun.h" // for port_convert_float*()
+#  include <stdint.h> // for uintptr_t
+#  include <string.h> // for memcpy()
+#  include <assert.h>
+#endif
+
+
+#ifdef __OPENCL_C_VERSION__
+#  define ASSERT_MEMORY(type)
+#else
+#  define ASSERT_MEMORY(type) \
+    assert(memory != NULL);   \
+    assert((uintptr_t)memory % sizeof(type) == 0)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Scalars (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+#define DEFINE_READ_FUNCTION(type) \
+PORT_INLINE port_##type##_t port_memory_read_##type(port_const_void_ptr_t memory, size_t offset) \
+{                                                       \
+    ASSERT_MEMORY(port_##type##_t);                     \
+    return *((const port_##type##_t*)memory + offset);  \
+}
+
+DEFINE_READ_FUNCTION(uint8)
+DEFINE_READ_FUNCTION(uint16)
+DEFINE_READ_FUNCTION(uint32)
+DEFINE_READ_FUNCTION(uint64)
+
+DEFINE_READ_FUNCTION(sint8)
+DEFINE_READ_FUNCTION(sint16)
+DEFINE_READ_FUNCTION(sint32)
+DEFINE_READ_FUNCTION(sint64)
+
+DEFINE_READ_FUNCTION(float32)
+DEFINE_READ_FUNCTION(float64)
+
+#undef DEFINE_READ_FUNCTION
+
+
+PORT_INLINE port_float32_t port_memory_read_float16(port_const_void_ptr_t memory, size_t offset)
+{
+#ifdef __OPENCL_C_VERSION__
+    return vload_half(offset, (const half*)memory);
+#else
+    ASSERT_MEMORY(port_uint16_t);
+    return port_convert_float16_to_float32(*((const port_uint16_t*)memory + offset));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Vectors (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTION(type, vlen) \
+PORT_INLINE port_##type##_v##vlen##_t port_memory_read_##type##_v##vlen(port_const_void_ptr_t memory, size_t offset) \
+{                                                               \
+    return vload##vlen(offset, (const port_##type##_t*)memory); \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTION(type, vlen) \
+PORT_INLINE port_##type##_v##vlen##_t port_memory_read_##type##_v##vlen(port_const_void_ptr_t memory, size_t offset) \
+{                                                                                             \
+    ASSERT_MEMORY(port_##type##_t);                                                           \
+    port_##type##_v##vlen##_t value;                                                          \
+    memcpy(value.s, (const port_##type##_t*)memory + offset, vlen * sizeof(port_##type##_t)); \
+    return value;                                                                             \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTIONS(type) \
+    DEFINE_READ_FUNCTION(type, 2) \
+    DEFINE_READ_FUNCTION(type, 3) \
+    DEFINE_READ_FUNCTION(type, 4) \
+    DEFINE_READ_FUNCTION(type, 8) \
+    DEFINE_READ_FUNCTION(type, 16)
+
+DEFINE_READ_FUNCTIONS(uint8)
+DEFINE_READ_FUNCTIONS(uint16)
+DEFINE_READ_FUNCTIONS(uint32)
+DEFINE_READ_FUNCTIONS(uint64)
+
+DEFINE_READ_FUNCTIONS(sint8)
+DEFINE_READ_FUNCTIONS(sint16)
+DEFINE_READ_FUNCTIONS(sint32)
+DEFINE_READ_FUNCTIONS(sint64)
+
+DEFINE_READ_FUNCTIONS(float32)
+DEFINE_READ_FUNCTIONS(float64)
+
+#undef DEFINE_READ_FUNCTIONS
+#undef DEFINE_READ_FUNCTION
+
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTION(vlen) \
+PORT_INLINE port_float32_v##vlen##_t port_memory_read_float16_v##vlen(port_const_void_ptr_t memory, size_t offset) \
+{                                                           \
+    return vload_half##vlen(offset, (const half*)memory);   \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTION(vlen) \
+PORT_INLINE port_float32_v##vlen##_t port_memory_read_float16_v##vlen(port_const_void_ptr_t memory, size_t offset) \
+{                                                                                                   \
+    ASSERT_MEMORY(port_uint16_t);                                                                   \
+    port_float32_v##vlen##_t value;                                                                 \
+    for (size_t i = 0; i < vlen; i++)                                                               \
+        value.s[i] = port_convert_float16_to_float32(((const port_uint16_t*)memory + offset)[i]);   \
+    return value;                                                                                   \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+DEFINE_READ_FUNCTION(2)
+DEFINE_READ_FUNCTION(3)
+DEFINE_READ_FUNCTION(4)
+DEFINE_READ_FUNCTION(8)
+DEFINE_READ_FUNCTION(16)
+
+#undef DEFINE_READ_FUNCTION
+
+///////////////////////////////////////////////////////////////////////////////
+// Scalars (named address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef __OPENCL_C_VERSION__
+
+typedef port_constant_void_ptr_t port_const_constant_void_ptr_t; // workaround needed for the 'constant' address space
+
+#define DEFINE_READ_FUNCTION(type, address_space) \
+PORT_INLINE port_##type##_t port_memory_read_##address_space##_##type( \
+        port_const_##address_space##_void_ptr_t memory, size_t offset) \
+{                                                                           \
+    return *((const __##address_space port_##type##_t*)memory + offset);    \
+}
+
+#define DEFINE_READ_FUNCTIONS(type) \
+    DEFINE_READ_FUNCTION(type, local) \
+    DEFINE_READ_FUNCTION(type, global) \
+    DEFINE_READ_FUNCTION(type, constant)
+
+DEFINE_READ_FUNCTIONS(uint8)
+DEFINE_READ_FUNCTIONS(uint16)
+DEFINE_READ_FUNCTIONS(uint32)
+DEFINE_READ_FUNCTIONS(uint64)
+
+DEFINE_READ_FUNCTIONS(sint8)
+DEFINE_READ_FUNCTIONS(sint16)
+DEFINE_READ_FUNCTIONS(sint32)
+DEFINE_READ_FUNCTIONS(sint64)
+
+DEFINE_READ_FUNCTIONS(float32)
+DEFINE_READ_FUNCTIONS(float64)
+
+#undef DEFINE_READ_FUNCTIONS
+#undef DEFINE_READ_FUNCTION
+
+
+#define DEFINE_READ_FUNCTION(address_space) \
+PORT_INLINE port_float32_t port_memory_read_##address_space##_float16( \
+        port_const_##address_space##_void_ptr_t memory, size_t offset) \
+{                                                                       \
+    return vload_half(offset, (const __##address_space half*)memory);   \
+}
+
+DEFINE_READ_FUNCTION(local)
+DEFINE_READ_FUNCTION(global)
+DEFINE_READ_FUNCTION(constant)
+
+#undef DEFINE_READ_FUNCTION
+
+#endif // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Vectors (named address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTION(type, vlen, address_space) \
+PORT_INLINE port_##type##_v##vlen##_t port_memory_read_##address_space##_##type##_v##vlen( \
+        port_const_##address_space##_void_ptr_t memory, size_t offset) \
+{                                                                                   \
+    return vload##vlen(offset, (const __##address_space port_##type##_t*)memory);   \
+}
+
+#define DEFINE_READ_FUNCTIONS(type) \
+    DEFINE_READ_FUNCTION(type, 2, local) \
+    DEFINE_READ_FUNCTION(type, 2, global) \
+    DEFINE_READ_FUNCTION(type, 2, constant) \
+    DEFINE_READ_FUNCTION(type, 3, local) \
+    DEFINE_READ_FUNCTION(type, 3, global) \
+    DEFINE_READ_FUNCTION(type, 3, constant) \
+    DEFINE_READ_FUNCTION(type, 4, local) \
+    DEFINE_READ_FUNCTION(type, 4, global) \
+    DEFINE_READ_FUNCTION(type, 4, constant) \
+    DEFINE_READ_FUNCTION(type, 8, local) \
+    DEFINE_READ_FUNCTION(type, 8, global) \
+    DEFINE_READ_FUNCTION(type, 8, constant) \
+    DEFINE_READ_FUNCTION(type, 16, local) \
+    DEFINE_READ_FUNCTION(type, 16, global) \
+    DEFINE_READ_FUNCTION(type, 16, constant)
+
+DEFINE_READ_FUNCTIONS(uint8)
+DEFINE_READ_FUNCTIONS(uint16)
+DEFINE_READ_FUNCTIONS(uint32)
+DEFINE_READ_FUNCTIONS(uint64)
+
+DEFINE_READ_FUNCTIONS(sint8)
+DEFINE_READ_FUNCTIONS(sint16)
+DEFINE_READ_FUNCTIONS(sint32)
+DEFINE_READ_FUNCTIONS(sint64)
+
+DEFINE_READ_FUNCTIONS(float32)
+DEFINE_READ_FUNCTIONS(float64)
+
+#undef DEFINE_READ_FUNCTIONS
+#undef DEFINE_READ_FUNCTION
+
+
+#define DEFINE_READ_FUNCTION(vlen, address_space) \
+PORT_INLINE port_float32_v##vlen##_t port_memory_read_##address_space##_float16_v##vlen( \
+        port_const_##address_space##_void_ptr_t memory, size_t offset) \
+{                                                                           \
+    return vload_half##vlen(offset, (const __##address_space half*)memory); \
+}
+
+#define DEFINE_READ_FUNCTIONS(vlen) \
+    DEFINE_READ_FUNCTION(vlen, local) \
+    DEFINE_READ_FUNCTION(vlen, global) \
+    DEFINE_READ_FUNCTION(vlen, constant)
+
+DEFINE_READ_FUNCTIONS(2)
+DEFINE_READ_FUNCTIONS(3)
+DEFINE_READ_FUNCTIONS(4)
+DEFINE_READ_FUNCTIONS(8)
+DEFINE_READ_FUNCTIONS(16)
+
+#undef DEFINE_READ_FUNCTIONS
+#undef DEFINE_READ_FUNCTION
+
+#endif // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Unaligned access (all address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * On CPU, memcpy() of a constant size compiles to unaligned loads.
+ * OpenCL has no unaligned loads, so values are assembled byte by byte in private memory.
+ */
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTION(type, suffix, num_elements, address_space, qualifier) \
+PORT_INLINE port_##type##suffix##_t port_memory_read##address_space##_##type##suffix##_unaligned( \
+        port_const##address_space##_void_ptr_t memory, size_t offset) \
+{                                                                                                   \
+    port_##type##suffix##_t value;                                                                  \
+    for (size_t i = 0; i < num_elements * sizeof(port_##type##_t); i++)                             \
+        ((__private port_uint8_t*)&value)[i] = ((const qualifier port_uint8_t*)memory)[offset + i]; \
+    return value;                                                                                   \
+}
+
+#define DEFINE_FLOAT16_READ_FUNCTION(suffix, vlen, num_elements, address_space, qualifier) \
+PORT_INLINE port_float32##suffix##_t port_memory_read##address_space##_float16##suffix##_unaligned( \
+        port_const##address_space##_void_ptr_t memory, size_t offset) \
+{                                                                                                 \
+    port_uint16_t bits[num_elements];                                                             \
+    for (size_t i = 0; i < sizeof(bits); i++)                                                     \
+        ((__private port_uint8_t*)bits)[i] = ((const qualifier port_uint8_t*)memory)[offset + i]; \
+    return vload_half##vlen(0, (const __private half*)bits);                                      \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTION(type, suffix, num_elements, address_space, qualifier) \
+PORT_INLINE port_##type##suffix##_t port_memory_read_##type##suffix##_unaligned( \
+        port_const_void_ptr_t memory, size_t offset) \
+{                                                                                         \
+    assert(memory != NULL);                                                               \
+    port_##type##suffix##_t value;                                                        \
+    memcpy(&value, (const char*)memory + offset, num_elements * sizeof(port_##type##_t)); \
+    return value;                                                                         \
+}
+
+#define DEFINE_FLOAT16_READ_FUNCTION(suffix, vlen, num_elements, address_space, qualifier) \
+PORT_INLINE port_float32##suffix##_t port_memory_read_float16##suffix##_unaligned( \
+        port_const_void_ptr_t memory, size_t offset) \
+{                                                                                \
+    assert(memory != NULL);                                                      \
+    port_uint16_t bits[num_elements];                                            \
+    memcpy(bits, (const char*)memory + offset, sizeof(bits));                    \
+    port_float32##suffix##_t value;                                              \
+    for (size_t i = 0; i < num_elements; i++)                                    \
+        ((port_float32_t*)&value)[i] = port_convert_float16_to_float32(bits[i]); \
+    return value;                                                                \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+#define DEFINE_READ_FUNCTIONS_FOR_TYPE(type, address_space, qualifier) \
+    DEFINE_READ_FUNCTION(type, , 1, address_space, qualifier) \
+    DEFINE_READ_FUNCTION(type, _v2, 2, address_space, qualifier) \
+    DEFINE_READ_FUNCTION(type, _v3, 3, address_space, qualifier) \
+    DEFINE_READ_FUNCTION(type, _v4, 4, address_space, qualifier) \
+    DEFINE_READ_FUNCTION(type, _v8, 8, address_space, qualifier) \
+    DEFINE_READ_FUNCTION(type, _v16, 16, address_space, qualifier)
+
+#define DEFINE_READ_FUNCTIONS(address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(uint8, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(uint16, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(uint32, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(uint64, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(sint8, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(sint16, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(sint32, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(sint64, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(float32, address_space, qualifier) \
+    DEFINE_READ_FUNCTIONS_FOR_TYPE(float64, address_space, qualifier) \
+    DEFINE_FLOAT16_READ_FUNCTION(, , 1, address_space, qualifier) \
+    DEFINE_FLOAT16_READ_FUNCTION(_v2, 2, 2, address_space, qualifier) \
+    DEFINE_FLOAT16_READ_FUNCTION(_v3, 3, 3, address_space, qualifier) \
+    DEFINE_FLOAT16_READ_FUNCTION(_v4, 4, 4, address_space, qualifier) \
+    DEFINE_FLOAT16_READ_FUNCTION(_v8, 8, 8, address_space, qualifier) \
+    DEFINE_FLOAT16_READ_FUNCTION(_v16, 16, 16, address_space, qualifier)
+
+DEFINE_READ_FUNCTIONS(, )
+#ifdef __OPENCL_C_VERSION__
+DEFINE_READ_FUNCTIONS(_local, __local)
+DEFINE_READ_FUNCTIONS(_global, __global)
+DEFINE_READ_FUNCTIONS(_constant, __constant)
+#endif
+
+#undef DEFINE_READ_FUNCTIONS
+#undef DEFINE_READ_FUNCTIONS_FOR_TYPE
+#undef DEFINE_FLOAT16_READ_FUNCTION
+#undef DEFINE_READ_FUNCTION
+
+#undef ASSERT_MEMORY
+
+#endif // _PORT_MEMORY_READ_INL_H_
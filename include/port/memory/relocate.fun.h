@@ -0,0 +1,77 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Relocation of memory unit graphs.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_RELOCATE_FUN_H_
+#define _PORT_MEMORY_RELOCATE_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/relocate.typ.h"
+#include "port/pointer.typ.h"
+
+
+/**
+ * @brief Relocate nodes reachable from roots into a new segment.
+ *
+ * Nodes are copied into a new segment in BFS or DFS order,
+ * so that related nodes are placed close to each other.
+ * References between relocated nodes are rewritten: forward references
+ * become near references (relative to the referencing node) wherever possible,
+ * others become far references to the new segment.
+ * Nodes that are targets of far references are aligned to far offset scale.
+ *
+ * Forward references which do not fit into near references are made far.
+ * Far references reach only the first (1 << (N - 1 - format.far.num_tidx_bits)) << format.far.offset_lshift
+ * bytes of the new segment (N is the number of bits in port_memory_ref_t),
+ * relocation fails if a root or another far reference target is placed beyond that.
+ *
+ * Near references in the source graph are relative to the referencing node,
+ * near references among roots are relative to base_ptr.
+ * All references must point to the beginnings of nodes.
+ * Source memory is not modified.
+ *
+ * The new segment must be registered in the memory table at params.new_tidx
+ * before the new references can be followed.
+ *
+ * @return True on success, false on failure.
+ */
+bool
+port_memory_relocate(
+        const port_memory_ref_t roots[], ///< [in] References to root nodes.
+        size_t num_roots, ///< [in] Number of root nodes.
+
+        port_memory_ref_format_t format, ///< [in] Memory reference format.
+        port_const_void_ptr_t base_ptr, ///< [in] Base address for near references among roots.
+        const port_const_void_ptr_t *memory_table, ///< [in] Table of memory pointers for far memory references.
+
+        port_memory_relocation_params_t params, ///< [in] Relocation parameters.
+
+        port_memory_ref_t new_roots[], ///< [out] Far references to relocated root nodes.
+        port_memory_relocation_t *result ///< [out] Relocation result.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_RELOCATE_FUN_H_
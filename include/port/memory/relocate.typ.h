@@ -0,0 +1,86 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for relocation of memory unit graphs.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_RELOCATE_TYP_H_
+#define _PORT_MEMORY_RELOCATE_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.typ.h"
+#include "port/memory/unit.typ.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Node map function.
+ *
+ * Describes the node: its size and units containing memory references to other nodes.
+ * Units containing null or foreign references must not be listed.
+ *
+ * @return True on success, false if the node is invalid.
+ */
+typedef bool (*port_memory_node_map_func_t)(
+        const port_memory_unit_t *node, ///< [in] Node.
+        void *data, ///< [in] Function data.
+
+        port_memory_ref_map_t *map ///< [out] Map of memory references in the node.
+);
+
+/**
+ * @brief Order of nodes in relocated memory.
+ */
+typedef enum port_memory_relocation_order {
+    PORT_MEMORY_RELOCATION_BFS = 0, ///< Breadth-first order.
+    PORT_MEMORY_RELOCATION_DFS,     ///< Depth-first (preorder) order.
+} port_memory_relocation_order_t;
+
+/**
+ * @brief Parameters of relocation.
+ */
+typedef struct port_memory_relocation_params {
+    port_memory_relocation_order_t order; ///< Order of nodes.
+
+    port_memory_node_map_func_t node_map_fn; ///< Node map function.
+    void *node_map_data; ///< Node map function data.
+
+    port_uint32_t new_tidx; ///< Memory table index of the new segment.
+} port_memory_relocation_params_t;
+
+/**
+ * @brief Result of relocation.
+ */
+typedef struct port_memory_relocation {
+    port_memory_unit_t *segment; ///< New segment (to be released with free()).
+    size_t num_bytes; ///< Size of the new segment in bytes.
+
+    size_t num_nodes; ///< Number of relocated nodes.
+    size_t num_near_refs; ///< Number of references encoded as near.
+    size_t num_far_refs; ///< Number of references encoded as far.
+} port_memory_relocation_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_RELOCATE_TYP_H_
@@ -0,0 +1,129 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Memory tables sharded between processes through POSIX shared memory.
+ *
+ * Every process creates its shard with the same name and table limits,
+ * so table indices and memory reference format are the same in all processes.
+ * Segment with table index tidx is shared memory object "/<name>.<tidx>".
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_SHARD_FUN_H_
+#define _PORT_MEMORY_SHARD_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/shard.typ.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Create shard of memory table.
+ *
+ * @see port_memory_table_create()
+ *
+ * @return Shard, or NULL on failure.
+ */
+port_memory_shards_t*
+port_memory_shards_create(
+        const char *name, ///< [in] Prefix of shared memory object names.
+        port_uint32_t num_shards, ///< [in] Number of shards.
+        port_uint32_t shard, ///< [in] Index of the own shard.
+        port_uint32_t max_segments, ///< [in] Maximum number of segments in all shards.
+        size_t max_segment_size ///< [in] Maximum segment size in bytes.
+);
+
+/**
+ * @brief Destroy shard of memory table and unmap its segments.
+ *
+ * If unlink is true, shared memory objects of the own shard are removed.
+ */
+void
+port_memory_shards_destroy(
+        port_memory_shards_t *shards, ///< [in] Shard.
+        bool unlink ///< [in] Whether to unlink shared memory objects of the own shard.
+);
+
+/**
+ * @brief Get shard owning table index.
+ *
+ * @return Index of the owner shard.
+ */
+port_uint32_t
+port_memory_shards_owner(
+        const port_memory_shards_t *shards, ///< [in] Shard.
+        port_uint32_t tidx ///< [in] Table index.
+);
+
+/**
+ * @brief Get shard owning memory referenced by a memory reference.
+ *
+ * Near references point to the segment of their base.
+ *
+ * @return Index of the owner shard.
+ */
+port_uint32_t
+port_memory_shards_ref_owner(
+        const port_memory_shards_t *shards, ///< [in] Shard.
+        port_memory_ref_t ref, ///< [in] Memory reference.
+        port_uint32_t base_tidx ///< [in] Table index of the segment containing near reference base.
+);
+
+/**
+ * @brief Allocate segment of the own shard in shared memory.
+ *
+ * Segment memory is zero-initialized.
+ *
+ * @return Segment memory, or NULL on failure.
+ */
+port_void_ptr_t
+port_memory_shards_alloc_segment(
+        port_memory_shards_t *shards, ///< [in] Shard.
+        port_uint32_t tidx, ///< [in] Table index owned by the shard.
+        size_t num_bytes ///< [in] Segment size in bytes.
+);
+
+/**
+ * @brief Map segment of another shard read-only.
+ *
+ * @return Segment memory, or NULL on failure.
+ */
+port_const_void_ptr_t
+port_memory_shards_attach_segment(
+        port_memory_shards_t *shards, ///< [in] Shard.
+        port_uint32_t tidx ///< [in] Table index owned by another shard.
+);
+
+/**
+ * @brief Map all existing segments of other shards that are not mapped yet.
+ *
+ * @return Number of newly mapped segments.
+ */
+port_uint32_t
+port_memory_shards_attach_all(
+        port_memory_shards_t *shards ///< [in] Shard.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_SHARD_FUN_H_
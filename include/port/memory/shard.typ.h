@@ -0,0 +1,52 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for sharded memory tables.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_SHARD_TYP_H_
+#define _PORT_MEMORY_SHARD_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/table.typ.h"
+
+
+/**
+ * @brief Shard of a memory table partitioned between processes.
+ *
+ * Table indices are assigned to shards in contiguous blocks.
+ * Segments of the own shard are writable, segments of other shards are mapped read-only.
+ */
+typedef struct port_memory_shards {
+    char *name; ///< Prefix of shared memory object names.
+
+    port_uint32_t num_shards; ///< Number of shards.
+    port_uint32_t shard; ///< Index of the own shard.
+    port_uint32_t tidx_per_shard; ///< Number of table indices assigned to a shard.
+
+    port_memory_table_t *table; ///< Memory table with segments of all shards.
+} port_memory_shards_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_SHARD_TYP_H_
@@ -0,0 +1,112 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Host-side memory table management.
+ *
+ * Segments are allocated with mmap(), optionally backed by huge pages
+ * and bound to a NUMA node, and registered in a memory table
+ * together with the reference format suitable for them.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_TABLE_FUN_H_
+#define _PORT_MEMORY_TABLE_FUN_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/table.typ.h"
+
+
+/**
+ * @brief Compute memory reference format for the given segment limits.
+ *
+ * Number of table index bits is the smallest sufficient for max_segments.
+ * Far offset shift is the smallest one (but not less than unit size shift)
+ * that lets far references address any unit of a segment of max_segment_size bytes.
+ * Near offset shift is equal to unit size shift.
+ *
+ * @return True on success, false if the limits cannot be satisfied.
+ */
+bool
+port_memory_table_format(
+        port_uint32_t max_segments, ///< [in] Maximum number of segments.
+        size_t max_segment_size, ///< [in] Maximum segment size in bytes.
+
+        port_memory_ref_format_t *format ///< [out] Memory reference format.
+);
+
+/**
+ * @brief Create empty memory table.
+ *
+ * @see port_memory_table_format()
+ *
+ * @return Memory table, or NULL on failure.
+ */
+port_memory_table_t*
+port_memory_table_create(
+        port_uint32_t max_segments, ///< [in] Maximum number of segments.
+        size_t max_segment_size ///< [in] Maximum segment size in bytes.
+);
+
+/**
+ * @brief Destroy memory table and unmap segments allocated by it.
+ *
+ * External segments are not freed.
+ */
+void
+port_memory_table_destroy(
+        port_memory_table_t *table ///< [in] Memory table.
+);
+
+/**
+ * @brief Allocate memory segment and register it in memory table.
+ *
+ * Segment memory is zero-initialized.
+ * For huge pages, the segment is aligned to huge page size,
+ * and size of the mapping is rounded up to it.
+ *
+ * @return Segment memory, or NULL on failure.
+ */
+port_void_ptr_t
+port_memory_table_alloc_segment(
+        port_memory_table_t *table, ///< [in,out] Memory table.
+        port_memory_segment_params_t params, ///< [in] Segment parameters.
+
+        port_uint32_t *tidx ///< [out] Table index of the segment, or NULL.
+);
+
+/**
+ * @brief Register external memory segment in memory table.
+ *
+ * @return True on success, false on failure.
+ */
+bool
+port_memory_table_add_segment(
+        port_memory_table_t *table, ///< [in,out] Memory table.
+        port_void_ptr_t memory, ///< [in] Segment memory.
+        size_t num_bytes, ///< [in] Segment size in bytes.
+
+        port_uint32_t *tidx ///< [out] Table index of the segment, or NULL.
+);
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_TABLE_FUN_H_
@@ -0,0 +1,85 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Types for host-side memory table management.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_TABLE_TYP_H_
+#define _PORT_MEMORY_TABLE_TYP_H_
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.typ.h"
+#include "port/pointer.typ.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @brief Kind of pages backing a memory segment.
+ */
+typedef enum port_memory_pages {
+    PORT_MEMORY_PAGES_DEFAULT = 0,      ///< Regular pages.
+    PORT_MEMORY_PAGES_TRANSPARENT_HUGE, ///< Transparent huge pages (advisory, falls back to regular pages).
+    PORT_MEMORY_PAGES_HUGETLB,          ///< Huge pages from the reserved pool (fails if the pool is exhausted).
+} port_memory_pages_t;
+
+/**
+ * @brief Parameters of memory segment allocation.
+ */
+typedef struct port_memory_segment_params {
+    size_t num_bytes; ///< Segment size in bytes.
+    port_memory_pages_t pages; ///< Kind of pages.
+    int numa_node; ///< NUMA node to bind memory to, or negative value for no binding.
+    bool populate; ///< Whether to prefault pages on allocation.
+} port_memory_segment_params_t;
+
+/**
+ * @brief Memory segment descriptor.
+ */
+typedef struct port_memory_segment {
+    port_void_ptr_t memory; ///< Segment memory.
+    size_t num_bytes; ///< Segment size in bytes.
+
+    port_void_ptr_t mapping; ///< Start of memory mapping owned by the table, or NULL for external segments.
+    size_t mapping_size; ///< Size of memory mapping owned by the table.
+} port_memory_segment_t;
+
+/**
+ * @brief Memory table with registered segments.
+ *
+ * Index of a segment is its table index in far memory references.
+ */
+typedef struct port_memory_table {
+    port_memory_ref_format_t format; ///< Format of memory references to the segments.
+    size_t max_segment_size; ///< Maximum segment size in bytes.
+
+    port_uint32_t capacity; ///< Maximum number of segments.
+    port_uint32_t num_segments; ///< Number of registered segments.
+
+    port_const_void_ptr_t *pointers; ///< Table of memory pointers for port_memory_at() and others.
+    port_memory_segment_t *segments; ///< Segment descriptors.
+} port_memory_table_t;
+
+#endif // __OPENCL_C_VERSION__
+
+#endif // _PORT_MEMORY_TABLE_TYP_H_
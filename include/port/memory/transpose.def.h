@@ -0,0 +1,37 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Macros for transposition of record arrays.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_TRANSPOSE_DEF_H_
+#define _PORT_MEMORY_TRANSPOSE_DEF_H_
+
+
+/**
+ * @brief Number of records processed by a single work item of transposition kernels.
+ *
+ * Number of records must be a multiple of this value.
+ */
+#define PORT_MEMORY_TRANSPOSE_TILE_SIZE 4
+
+#endif // _PORT_MEMORY_TRANSPOSE_DEF_H_
@@ -0,0 +1,167 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Kernels for transposition of record arrays between AoS and SoA layouts.
+ *
+ * Array of structures (AoS) stores num_records records of N fields contiguously.
+ * Structure of arrays (SoA) stores N arrays of num_records elements one after another,
+ * so field f of record i is located at index f*num_records + i.
+ *
+ * Each work item transposes PORT_MEMORY_TRANSPOSE_TILE_SIZE consecutive records,
+ * so kernels are to be executed over num_records / PORT_MEMORY_TRANSPOSE_TILE_SIZE work items.
+ * Source and destination arrays must not overlap.
+ *
+ * On CPU with SSE2, records of 32-bit and 64-bit elements with 2, 4, 8 or 16 fields
+ * are transposed with vector unpacks and shuffles, other records with scalar loops.
+ * In OpenCL, vload and vstore functions are used.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_TRANSPOSE_FUN_H_
+#define _PORT_MEMORY_TRANSPOSE_FUN_H_
+
+#include "port/memory/transpose.def.h"
+#include "port/kernel.def.h"
+#include "port/work.def.h"
+#include "port/pointer.typ.h"
+
+
+// Records of unsigned 8-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint8_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint8_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint8_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint8_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint8_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint8_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint8_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint8_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint8_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint8_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of unsigned 16-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint16_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint16_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint16_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint16_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint16_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint16_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint16_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint16_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint16_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint16_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of unsigned 32-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint32_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint32_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint32_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint32_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint32_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint32_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint32_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint32_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint32_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint32_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of unsigned 64-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint64_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint64_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint64_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint64_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_uint64_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint64_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint64_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint64_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint64_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_uint64_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of signed 8-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint8_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint8_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint8_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint8_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint8_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint8_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint8_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint8_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint8_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint8_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of signed 16-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint16_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint16_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint16_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint16_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint16_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint16_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint16_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint16_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint16_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint16_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of signed 32-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint32_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint32_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint32_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint32_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint32_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint32_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint32_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint32_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint32_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint32_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of signed 64-bit integers
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint64_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint64_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint64_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint64_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_sint64_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint64_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint64_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint64_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint64_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_sint64_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of 32-bit floating-point numbers
+PORT_KERNEL port_memory_transpose_aos_to_soa_float32_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float32_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float32_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float32_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float32_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float32_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float32_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float32_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float32_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float32_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+// Records of 64-bit floating-point numbers
+PORT_KERNEL port_memory_transpose_aos_to_soa_float64_x2(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float64_x3(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float64_x4(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float64_x8(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_aos_to_soa_float64_x16(port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float64_x2(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float64_x3(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float64_x4(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float64_x8(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+PORT_KERNEL port_memory_transpose_soa_to_aos_float64_x16(port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0));
+
+#endif // _PORT_MEMORY_TRANSPOSE_FUN_H_
@@ -28,6 +28,10 @@
 
 #include "port/pointer.typ.h"
 
+#ifdef PORT_FEATURE_INLINE
+#  include "port/memory/write.inl.h" // static inline definitions
+#endif
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for built-in types (generic address space)
@@ -679,6 +683,661 @@ void port_memory_write_global_float64_v16(port_global_void_ptr_t memory, size_t
 
 #endif // __OPENCL_C_VERSION__
 
+///////////////////////////////////////////////////////////////////////////////
+// Unaligned access to built-in types (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Offsets of unaligned accesses are measured in bytes, memory has no alignment requirements.
+ * Vectors of 3 elements occupy 3 elements in memory.
+ */
+
+// Unsigned integer (8-bit)
+void port_memory_write_uint8_unaligned(port_void_ptr_t memory, size_t offset, port_uint8_t value);
+void port_memory_write_uint8_v2_unaligned(port_void_ptr_t memory, size_t offset, port_uint8_v2_t value);
+void port_memory_write_uint8_v3_unaligned(port_void_ptr_t memory, size_t offset, port_uint8_v3_t value);
+void port_memory_write_uint8_v4_unaligned(port_void_ptr_t memory, size_t offset, port_uint8_v4_t value);
+void port_memory_write_uint8_v8_unaligned(port_void_ptr_t memory, size_t offset, port_uint8_v8_t value);
+void port_memory_write_uint8_v16_unaligned(port_void_ptr_t memory, size_t offset, port_uint8_v16_t value);
+
+// Unsigned integer (16-bit)
+void port_memory_write_uint16_unaligned(port_void_ptr_t memory, size_t offset, port_uint16_t value);
+void port_memory_write_uint16_v2_unaligned(port_void_ptr_t memory, size_t offset, port_uint16_v2_t value);
+void port_memory_write_uint16_v3_unaligned(port_void_ptr_t memory, size_t offset, port_uint16_v3_t value);
+void port_memory_write_uint16_v4_unaligned(port_void_ptr_t memory, size_t offset, port_uint16_v4_t value);
+void port_memory_write_uint16_v8_unaligned(port_void_ptr_t memory, size_t offset, port_uint16_v8_t value);
+void port_memory_write_uint16_v16_unaligned(port_void_ptr_t memory, size_t offset, port_uint16_v16_t value);
+
+// Unsigned integer (32-bit)
+void port_memory_write_uint32_unaligned(port_void_ptr_t memory, size_t offset, port_uint32_t value);
+void port_memory_write_uint32_v2_unaligned(port_void_ptr_t memory, size_t offset, port_uint32_v2_t value);
+void port_memory_write_uint32_v3_unaligned(port_void_ptr_t memory, size_t offset, port_uint32_v3_t value);
+void port_memory_write_uint32_v4_unaligned(port_void_ptr_t memory, size_t offset, port_uint32_v4_t value);
+void port_memory_write_uint32_v8_unaligned(port_void_ptr_t memory, size_t offset, port_uint32_v8_t value);
+void port_memory_write_uint32_v16_unaligned(port_void_ptr_t memory, size_t offset, port_uint32_v16_t value);
+
+// Unsigned integer (64-bit)
+void port_memory_write_uint64_unaligned(port_void_ptr_t memory, size_t offset, port_uint64_t value);
+void port_memory_write_uint64_v2_unaligned(port_void_ptr_t memory, size_t offset, port_uint64_v2_t value);
+void port_memory_write_uint64_v3_unaligned(port_void_ptr_t memory, size_t offset, port_uint64_v3_t value);
+void port_memory_write_uint64_v4_unaligned(port_void_ptr_t memory, size_t offset, port_uint64_v4_t value);
+void port_memory_write_uint64_v8_unaligned(port_void_ptr_t memory, size_t offset, port_uint64_v8_t value);
+void port_memory_write_uint64_v16_unaligned(port_void_ptr_t memory, size_t offset, port_uint64_v16_t value);
+
+// Signed integer (8-bit)
+void port_memory_write_sint8_unaligned(port_void_ptr_t memory, size_t offset, port_sint8_t value);
+void port_memory_write_sint8_v2_unaligned(port_void_ptr_t memory, size_t offset, port_sint8_v2_t value);
+void port_memory_write_sint8_v3_unaligned(port_void_ptr_t memory, size_t offset, port_sint8_v3_t value);
+void port_memory_write_sint8_v4_unaligned(port_void_ptr_t memory, size_t offset, port_sint8_v4_t value);
+void port_memory_write_sint8_v8_unaligned(port_void_ptr_t memory, size_t offset, port_sint8_v8_t value);
+void port_memory_write_sint8_v16_unaligned(port_void_ptr_t memory, size_t offset, port_sint8_v16_t value);
+
+// Signed integer (16-bit)
+void port_memory_write_sint16_unaligned(port_void_ptr_t memory, size_t offset, port_sint16_t value);
+void port_memory_write_sint16_v2_unaligned(port_void_ptr_t memory, size_t offset, port_sint16_v2_t value);
+void port_memory_write_sint16_v3_unaligned(port_void_ptr_t memory, size_t offset, port_sint16_v3_t value);
+void port_memory_write_sint16_v4_unaligned(port_void_ptr_t memory, size_t offset, port_sint16_v4_t value);
+void port_memory_write_sint16_v8_unaligned(port_void_ptr_t memory, size_t offset, port_sint16_v8_t value);
+void port_memory_write_sint16_v16_unaligned(port_void_ptr_t memory, size_t offset, port_sint16_v16_t value);
+
+// Signed integer (32-bit)
+void port_memory_write_sint32_unaligned(port_void_ptr_t memory, size_t offset, port_sint32_t value);
+void port_memory_write_sint32_v2_unaligned(port_void_ptr_t memory, size_t offset, port_sint32_v2_t value);
+void port_memory_write_sint32_v3_unaligned(port_void_ptr_t memory, size_t offset, port_sint32_v3_t value);
+void port_memory_write_sint32_v4_unaligned(port_void_ptr_t memory, size_t offset, port_sint32_v4_t value);
+void port_memory_write_sint32_v8_unaligned(port_void_ptr_t memory, size_t offset, port_sint32_v8_t value);
+void port_memory_write_sint32_v16_unaligned(port_void_ptr_t memory, size_t offset, port_sint32_v16_t value);
+
+// Signed integer (64-bit)
+void port_memory_write_sint64_unaligned(port_void_ptr_t memory, size_t offset, port_sint64_t value);
+void port_memory_write_sint64_v2_unaligned(port_void_ptr_t memory, size_t offset, port_sint64_v2_t value);
+void port_memory_write_sint64_v3_unaligned(port_void_ptr_t memory, size_t offset, port_sint64_v3_t value);
+void port_memory_write_sint64_v4_unaligned(port_void_ptr_t memory, size_t offset, port_sint64_v4_t value);
+void port_memory_write_sint64_v8_unaligned(port_void_ptr_t memory, size_t offset, port_sint64_v8_t value);
+void port_memory_write_sint64_v16_unaligned(port_void_ptr_t memory, size_t offset, port_sint64_v16_t value);
+
+// Floating-point number (16-bit)
+void port_memory_write_float16_unaligned(port_void_ptr_t memory, size_t offset, port_float32_t value);
+void port_memory_write_float16_v2_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v2_t value);
+void port_memory_write_float16_v3_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v3_t value);
+void port_memory_write_float16_v4_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v4_t value);
+void port_memory_write_float16_v8_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v8_t value);
+void port_memory_write_float16_v16_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v16_t value);
+
+// Floating-point number (32-bit)
+void port_memory_write_float32_unaligned(port_void_ptr_t memory, size_t offset, port_float32_t value);
+void port_memory_write_float32_v2_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v2_t value);
+void port_memory_write_float32_v3_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v3_t value);
+void port_memory_write_float32_v4_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v4_t value);
+void port_memory_write_float32_v8_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v8_t value);
+void port_memory_write_float32_v16_unaligned(port_void_ptr_t memory, size_t offset, port_float32_v16_t value);
+
+// Floating-point number (64-bit)
+void port_memory_write_float64_unaligned(port_void_ptr_t memory, size_t offset, port_float64_t value);
+void port_memory_write_float64_v2_unaligned(port_void_ptr_t memory, size_t offset, port_float64_v2_t value);
+void port_memory_write_float64_v3_unaligned(port_void_ptr_t memory, size_t offset, port_float64_v3_t value);
+void port_memory_write_float64_v4_unaligned(port_void_ptr_t memory, size_t offset, port_float64_v4_t value);
+void port_memory_write_float64_v8_unaligned(port_void_ptr_t memory, size_t offset, port_float64_v8_t value);
+void port_memory_write_float64_v16_unaligned(port_void_ptr_t memory, size_t offset, port_float64_v16_t value);
+
+#ifdef __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Unaligned access to built-in types (named address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+// Unsigned integer (8-bit)
+void port_memory_write_local_uint8_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint8_t value);
+void port_memory_write_global_uint8_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint8_t value);
+
+// 2-vector of unsigned integers (8-bit)
+void port_memory_write_local_uint8_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint8_v2_t value);
+void port_memory_write_global_uint8_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint8_v2_t value);
+
+// 3-vector of unsigned integers (8-bit)
+void port_memory_write_local_uint8_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint8_v3_t value);
+void port_memory_write_global_uint8_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint8_v3_t value);
+
+// 4-vector of unsigned integers (8-bit)
+void port_memory_write_local_uint8_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint8_v4_t value);
+void port_memory_write_global_uint8_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint8_v4_t value);
+
+// 8-vector of unsigned integers (8-bit)
+void port_memory_write_local_uint8_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint8_v8_t value);
+void port_memory_write_global_uint8_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint8_v8_t value);
+
+// 16-vector of unsigned integers (8-bit)
+void port_memory_write_local_uint8_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint8_v16_t value);
+void port_memory_write_global_uint8_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint8_v16_t value);
+
+
+// Unsigned integer (16-bit)
+void port_memory_write_local_uint16_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint16_t value);
+void port_memory_write_global_uint16_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint16_t value);
+
+// 2-vector of unsigned integers (16-bit)
+void port_memory_write_local_uint16_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint16_v2_t value);
+void port_memory_write_global_uint16_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint16_v2_t value);
+
+// 3-vector of unsigned integers (16-bit)
+void port_memory_write_local_uint16_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint16_v3_t value);
+void port_memory_write_global_uint16_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint16_v3_t value);
+
+// 4-vector of unsigned integers (16-bit)
+void port_memory_write_local_uint16_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint16_v4_t value);
+void port_memory_write_global_uint16_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint16_v4_t value);
+
+// 8-vector of unsigned integers (16-bit)
+void port_memory_write_local_uint16_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint16_v8_t value);
+void port_memory_write_global_uint16_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint16_v8_t value);
+
+// 16-vector of unsigned integers (16-bit)
+void port_memory_write_local_uint16_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint16_v16_t value);
+void port_memory_write_global_uint16_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint16_v16_t value);
+
+
+// Unsigned integer (32-bit)
+void port_memory_write_local_uint32_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint32_t value);
+void port_memory_write_global_uint32_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint32_t value);
+
+// 2-vector of unsigned integers (32-bit)
+void port_memory_write_local_uint32_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint32_v2_t value);
+void port_memory_write_global_uint32_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint32_v2_t value);
+
+// 3-vector of unsigned integers (32-bit)
+void port_memory_write_local_uint32_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint32_v3_t value);
+void port_memory_write_global_uint32_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint32_v3_t value);
+
+// 4-vector of unsigned integers (32-bit)
+void port_memory_write_local_uint32_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint32_v4_t value);
+void port_memory_write_global_uint32_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint32_v4_t value);
+
+// 8-vector of unsigned integers (32-bit)
+void port_memory_write_local_uint32_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint32_v8_t value);
+void port_memory_write_global_uint32_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint32_v8_t value);
+
+// 16-vector of unsigned integers (32-bit)
+void port_memory_write_local_uint32_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint32_v16_t value);
+void port_memory_write_global_uint32_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint32_v16_t value);
+
+
+// Unsigned integer (64-bit)
+void port_memory_write_local_uint64_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint64_t value);
+void port_memory_write_global_uint64_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint64_t value);
+
+// 2-vector of unsigned integers (64-bit)
+void port_memory_write_local_uint64_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint64_v2_t value);
+void port_memory_write_global_uint64_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint64_v2_t value);
+
+// 3-vector of unsigned integers (64-bit)
+void port_memory_write_local_uint64_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint64_v3_t value);
+void port_memory_write_global_uint64_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint64_v3_t value);
+
+// 4-vector of unsigned integers (64-bit)
+void port_memory_write_local_uint64_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint64_v4_t value);
+void port_memory_write_global_uint64_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint64_v4_t value);
+
+// 8-vector of unsigned integers (64-bit)
+void port_memory_write_local_uint64_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint64_v8_t value);
+void port_memory_write_global_uint64_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint64_v8_t value);
+
+// 16-vector of unsigned integers (64-bit)
+void port_memory_write_local_uint64_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_uint64_v16_t value);
+void port_memory_write_global_uint64_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_uint64_v16_t value);
+
+
+// Signed integer (8-bit)
+void port_memory_write_local_sint8_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint8_t value);
+void port_memory_write_global_sint8_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint8_t value);
+
+// 2-vector of signed integers (8-bit)
+void port_memory_write_local_sint8_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint8_v2_t value);
+void port_memory_write_global_sint8_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint8_v2_t value);
+
+// 3-vector of signed integers (8-bit)
+void port_memory_write_local_sint8_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint8_v3_t value);
+void port_memory_write_global_sint8_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint8_v3_t value);
+
+// 4-vector of signed integers (8-bit)
+void port_memory_write_local_sint8_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint8_v4_t value);
+void port_memory_write_global_sint8_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint8_v4_t value);
+
+// 8-vector of signed integers (8-bit)
+void port_memory_write_local_sint8_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint8_v8_t value);
+void port_memory_write_global_sint8_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint8_v8_t value);
+
+// 16-vector of signed integers (8-bit)
+void port_memory_write_local_sint8_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint8_v16_t value);
+void port_memory_write_global_sint8_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint8_v16_t value);
+
+
+// Signed integer (16-bit)
+void port_memory_write_local_sint16_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint16_t value);
+void port_memory_write_global_sint16_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint16_t value);
+
+// 2-vector of signed integers (16-bit)
+void port_memory_write_local_sint16_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint16_v2_t value);
+void port_memory_write_global_sint16_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint16_v2_t value);
+
+// 3-vector of signed integers (16-bit)
+void port_memory_write_local_sint16_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint16_v3_t value);
+void port_memory_write_global_sint16_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint16_v3_t value);
+
+// 4-vector of signed integers (16-bit)
+void port_memory_write_local_sint16_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint16_v4_t value);
+void port_memory_write_global_sint16_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint16_v4_t value);
+
+// 8-vector of signed integers (16-bit)
+void port_memory_write_local_sint16_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint16_v8_t value);
+void port_memory_write_global_sint16_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint16_v8_t value);
+
+// 16-vector of signed integers (16-bit)
+void port_memory_write_local_sint16_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint16_v16_t value);
+void port_memory_write_global_sint16_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint16_v16_t value);
+
+
+// Signed integer (32-bit)
+void port_memory_write_local_sint32_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint32_t value);
+void port_memory_write_global_sint32_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint32_t value);
+
+// 2-vector of signed integers (32-bit)
+void port_memory_write_local_sint32_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint32_v2_t value);
+void port_memory_write_global_sint32_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint32_v2_t value);
+
+// 3-vector of signed integers (32-bit)
+void port_memory_write_local_sint32_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint32_v3_t value);
+void port_memory_write_global_sint32_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint32_v3_t value);
+
+// 4-vector of signed integers (32-bit)
+void port_memory_write_local_sint32_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint32_v4_t value);
+void port_memory_write_global_sint32_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint32_v4_t value);
+
+// 8-vector of signed integers (32-bit)
+void port_memory_write_local_sint32_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint32_v8_t value);
+void port_memory_write_global_sint32_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint32_v8_t value);
+
+// 16-vector of signed integers (32-bit)
+void port_memory_write_local_sint32_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint32_v16_t value);
+void port_memory_write_global_sint32_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint32_v16_t value);
+
+
+// Signed integer (64-bit)
+void port_memory_write_local_sint64_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint64_t value);
+void port_memory_write_global_sint64_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint64_t value);
+
+// 2-vector of signed integers (64-bit)
+void port_memory_write_local_sint64_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint64_v2_t value);
+void port_memory_write_global_sint64_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint64_v2_t value);
+
+// 3-vector of signed integers (64-bit)
+void port_memory_write_local_sint64_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint64_v3_t value);
+void port_memory_write_global_sint64_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint64_v3_t value);
+
+// 4-vector of signed integers (64-bit)
+void port_memory_write_local_sint64_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint64_v4_t value);
+void port_memory_write_global_sint64_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint64_v4_t value);
+
+// 8-vector of signed integers (64-bit)
+void port_memory_write_local_sint64_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint64_v8_t value);
+void port_memory_write_global_sint64_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint64_v8_t value);
+
+// 16-vector of signed integers (64-bit)
+void port_memory_write_local_sint64_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_sint64_v16_t value);
+void port_memory_write_global_sint64_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_sint64_v16_t value);
+
+
+// Floating-point number (16-bit)
+void port_memory_write_local_float16_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_t value);
+void port_memory_write_global_float16_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_t value);
+
+// 2-vector of floating-point numbers (16-bit)
+void port_memory_write_local_float16_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v2_t value);
+void port_memory_write_global_float16_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v2_t value);
+
+// 3-vector of floating-point numbers (16-bit)
+void port_memory_write_local_float16_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v3_t value);
+void port_memory_write_global_float16_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v3_t value);
+
+// 4-vector of floating-point numbers (16-bit)
+void port_memory_write_local_float16_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v4_t value);
+void port_memory_write_global_float16_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v4_t value);
+
+// 8-vector of floating-point numbers (16-bit)
+void port_memory_write_local_float16_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v8_t value);
+void port_memory_write_global_float16_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v8_t value);
+
+// 16-vector of floating-point numbers (16-bit)
+void port_memory_write_local_float16_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v16_t value);
+void port_memory_write_global_float16_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v16_t value);
+
+
+// Floating-point number (32-bit)
+void port_memory_write_local_float32_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_t value);
+void port_memory_write_global_float32_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_t value);
+
+// 2-vector of floating-point numbers (32-bit)
+void port_memory_write_local_float32_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v2_t value);
+void port_memory_write_global_float32_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v2_t value);
+
+// 3-vector of floating-point numbers (32-bit)
+void port_memory_write_local_float32_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v3_t value);
+void port_memory_write_global_float32_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v3_t value);
+
+// 4-vector of floating-point numbers (32-bit)
+void port_memory_write_local_float32_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v4_t value);
+void port_memory_write_global_float32_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v4_t value);
+
+// 8-vector of floating-point numbers (32-bit)
+void port_memory_write_local_float32_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v8_t value);
+void port_memory_write_global_float32_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v8_t value);
+
+// 16-vector of floating-point numbers (32-bit)
+void port_memory_write_local_float32_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_float32_v16_t value);
+void port_memory_write_global_float32_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_float32_v16_t value);
+
+
+// Floating-point number (64-bit)
+void port_memory_write_local_float64_unaligned(port_local_void_ptr_t memory, size_t offset, port_float64_t value);
+void port_memory_write_global_float64_unaligned(port_global_void_ptr_t memory, size_t offset, port_float64_t value);
+
+// 2-vector of floating-point numbers (64-bit)
+void port_memory_write_local_float64_v2_unaligned(port_local_void_ptr_t memory, size_t offset, port_float64_v2_t value);
+void port_memory_write_global_float64_v2_unaligned(port_global_void_ptr_t memory, size_t offset, port_float64_v2_t value);
+
+// 3-vector of floating-point numbers (64-bit)
+void port_memory_write_local_float64_v3_unaligned(port_local_void_ptr_t memory, size_t offset, port_float64_v3_t value);
+void port_memory_write_global_float64_v3_unaligned(port_global_void_ptr_t memory, size_t offset, port_float64_v3_t value);
+
+// 4-vector of floating-point numbers (64-bit)
+void port_memory_write_local_float64_v4_unaligned(port_local_void_ptr_t memory, size_t offset, port_float64_v4_t value);
+void port_memory_write_global_float64_v4_unaligned(port_global_void_ptr_t memory, size_t offset, port_float64_v4_t value);
+
+// 8-vector of floating-point numbers (64-bit)
+void port_memory_write_local_float64_v8_unaligned(port_local_void_ptr_t memory, size_t offset, port_float64_v8_t value);
+void port_memory_write_global_float64_v8_unaligned(port_global_void_ptr_t memory, size_t offset, port_float64_v8_t value);
+
+// 16-vector of floating-point numbers (64-bit)
+void port_memory_write_local_float64_v16_unaligned(port_local_void_ptr_t memory, size_t offset, port_float64_v16_t value);
+void port_memory_write_global_float64_v16_unaligned(port_global_void_ptr_t memory, size_t offset, port_float64_v16_t value);
+
+#else // __OPENCL_C_VERSION__
+
+// Unsigned integer (8-bit)
+#  define port_memory_write_local_uint8_unaligned             port_memory_write_uint8_unaligned
+#  define port_memory_write_global_uint8_unaligned            port_memory_write_uint8_unaligned
+
+// 2-vector of unsigned integers (8-bit)
+#  define port_memory_write_local_uint8_v2_unaligned          port_memory_write_uint8_v2_unaligned
+#  define port_memory_write_global_uint8_v2_unaligned         port_memory_write_uint8_v2_unaligned
+
+// 3-vector of unsigned integers (8-bit)
+#  define port_memory_write_local_uint8_v3_unaligned          port_memory_write_uint8_v3_unaligned
+#  define port_memory_write_global_uint8_v3_unaligned         port_memory_write_uint8_v3_unaligned
+
+// 4-vector of unsigned integers (8-bit)
+#  define port_memory_write_local_uint8_v4_unaligned          port_memory_write_uint8_v4_unaligned
+#  define port_memory_write_global_uint8_v4_unaligned         port_memory_write_uint8_v4_unaligned
+
+// 8-vector of unsigned integers (8-bit)
+#  define port_memory_write_local_uint8_v8_unaligned          port_memory_write_uint8_v8_unaligned
+#  define port_memory_write_global_uint8_v8_unaligned         port_memory_write_uint8_v8_unaligned
+
+// 16-vector of unsigned integers (8-bit)
+#  define port_memory_write_local_uint8_v16_unaligned         port_memory_write_uint8_v16_unaligned
+#  define port_memory_write_global_uint8_v16_unaligned        port_memory_write_uint8_v16_unaligned
+
+
+// Unsigned integer (16-bit)
+#  define port_memory_write_local_uint16_unaligned            port_memory_write_uint16_unaligned
+#  define port_memory_write_global_uint16_unaligned           port_memory_write_uint16_unaligned
+
+// 2-vector of unsigned integers (16-bit)
+#  define port_memory_write_local_uint16_v2_unaligned         port_memory_write_uint16_v2_unaligned
+#  define port_memory_write_global_uint16_v2_unaligned        port_memory_write_uint16_v2_unaligned
+
+// 3-vector of unsigned integers (16-bit)
+#  define port_memory_write_local_uint16_v3_unaligned         port_memory_write_uint16_v3_unaligned
+#  define port_memory_write_global_uint16_v3_unaligned        port_memory_write_uint16_v3_unaligned
+
+// 4-vector of unsigned integers (16-bit)
+#  define port_memory_write_local_uint16_v4_unaligned         port_memory_write_uint16_v4_unaligned
+#  define port_memory_write_global_uint16_v4_unaligned        port_memory_write_uint16_v4_unaligned
+
+// 8-vector of unsigned integers (16-bit)
+#  define port_memory_write_local_uint16_v8_unaligned         port_memory_write_uint16_v8_unaligned
+#  define port_memory_write_global_uint16_v8_unaligned        port_memory_write_uint16_v8_unaligned
+
+// 16-vector of unsigned integers (16-bit)
+#  define port_memory_write_local_uint16_v16_unaligned        port_memory_write_uint16_v16_unaligned
+#  define port_memory_write_global_uint16_v16_unaligned       port_memory_write_uint16_v16_unaligned
+
+
+// Unsigned integer (32-bit)
+#  define port_memory_write_local_uint32_unaligned            port_memory_write_uint32_unaligned
+#  define port_memory_write_global_uint32_unaligned           port_memory_write_uint32_unaligned
+
+// 2-vector of unsigned integers (32-bit)
+#  define port_memory_write_local_uint32_v2_unaligned         port_memory_write_uint32_v2_unaligned
+#  define port_memory_write_global_uint32_v2_unaligned        port_memory_write_uint32_v2_unaligned
+
+// 3-vector of unsigned integers (32-bit)
+#  define port_memory_write_local_uint32_v3_unaligned         port_memory_write_uint32_v3_unaligned
+#  define port_memory_write_global_uint32_v3_unaligned        port_memory_write_uint32_v3_unaligned
+
+// 4-vector of unsigned integers (32-bit)
+#  define port_memory_write_local_uint32_v4_unaligned         port_memory_write_uint32_v4_unaligned
+#  define port_memory_write_global_uint32_v4_unaligned        port_memory_write_uint32_v4_unaligned
+
+// 8-vector of unsigned integers (32-bit)
+#  define port_memory_write_local_uint32_v8_unaligned         port_memory_write_uint32_v8_unaligned
+#  define port_memory_write_global_uint32_v8_unaligned        port_memory_write_uint32_v8_unaligned
+
+// 16-vector of unsigned integers (32-bit)
+#  define port_memory_write_local_uint32_v16_unaligned        port_memory_write_uint32_v16_unaligned
+#  define port_memory_write_global_uint32_v16_unaligned       port_memory_write_uint32_v16_unaligned
+
+
+// Unsigned integer (64-bit)
+#  define port_memory_write_local_uint64_unaligned            port_memory_write_uint64_unaligned
+#  define port_memory_write_global_uint64_unaligned           port_memory_write_uint64_unaligned
+
+// 2-vector of unsigned integers (64-bit)
+#  define port_memory_write_local_uint64_v2_unaligned         port_memory_write_uint64_v2_unaligned
+#  define port_memory_write_global_uint64_v2_unaligned        port_memory_write_uint64_v2_unaligned
+
+// 3-vector of unsigned integers (64-bit)
+#  define port_memory_write_local_uint64_v3_unaligned         port_memory_write_uint64_v3_unaligned
+#  define port_memory_write_global_uint64_v3_unaligned        port_memory_write_uint64_v3_unaligned
+
+// 4-vector of unsigned integers (64-bit)
+#  define port_memory_write_local_uint64_v4_unaligned         port_memory_write_uint64_v4_unaligned
+#  define port_memory_write_global_uint64_v4_unaligned        port_memory_write_uint64_v4_unaligned
+
+// 8-vector of unsigned integers (64-bit)
+#  define port_memory_write_local_uint64_v8_unaligned         port_memory_write_uint64_v8_unaligned
+#  define port_memory_write_global_uint64_v8_unaligned        port_memory_write_uint64_v8_unaligned
+
+// 16-vector of unsigned integers (64-bit)
+#  define port_memory_write_local_uint64_v16_unaligned        port_memory_write_uint64_v16_unaligned
+#  define port_memory_write_global_uint64_v16_unaligned       port_memory_write_uint64_v16_unaligned
+
+
+// Signed integer (8-bit)
+#  define port_memory_write_local_sint8_unaligned             port_memory_write_sint8_unaligned
+#  define port_memory_write_global_sint8_unaligned            port_memory_write_sint8_unaligned
+
+// 2-vector of signed integers (8-bit)
+#  define port_memory_write_local_sint8_v2_unaligned          port_memory_write_sint8_v2_unaligned
+#  define port_memory_write_global_sint8_v2_unaligned         port_memory_write_sint8_v2_unaligned
+
+// 3-vector of signed integers (8-bit)
+#  define port_memory_write_local_sint8_v3_unaligned          port_memory_write_sint8_v3_unaligned
+#  define port_memory_write_global_sint8_v3_unaligned         port_memory_write_sint8_v3_unaligned
+
+// 4-vector of signed integers (8-bit)
+#  define port_memory_write_local_sint8_v4_unaligned          port_memory_write_sint8_v4_unaligned
+#  define port_memory_write_global_sint8_v4_unaligned         port_memory_write_sint8_v4_unaligned
+
+// 8-vector of signed integers (8-bit)
+#  define port_memory_write_local_sint8_v8_unaligned          port_memory_write_sint8_v8_unaligned
+#  define port_memory_write_global_sint8_v8_unaligned         port_memory_write_sint8_v8_unaligned
+
+// 16-vector of signed integers (8-bit)
+#  define port_memory_write_local_sint8_v16_unaligned         port_memory_write_sint8_v16_unaligned
+#  define port_memory_write_global_sint8_v16_unaligned        port_memory_write_sint8_v16_unaligned
+
+
+// Signed integer (16-bit)
+#  define port_memory_write_local_sint16_unaligned            port_memory_write_sint16_unaligned
+#  define port_memory_write_global_sint16_unaligned           port_memory_write_sint16_unaligned
+
+// 2-vector of signed integers (16-bit)
+#  define port_memory_write_local_sint16_v2_unaligned         port_memory_write_sint16_v2_unaligned
+#  define port_memory_write_global_sint16_v2_unaligned        port_memory_write_sint16_v2_unaligned
+
+// 3-vector of signed integers (16-bit)
+#  define port_memory_write_local_sint16_v3_unaligned         port_memory_write_sint16_v3_unaligned
+#  define port_memory_write_global_sint16_v3_unaligned        port_memory_write_sint16_v3_unaligned
+
+// 4-vector of signed integers (16-bit)
+#  define port_memory_write_local_sint16_v4_unaligned         port_memory_write_sint16_v4_unaligned
+#  define port_memory_write_global_sint16_v4_unaligned        port_memory_write_sint16_v4_unaligned
+
+// 8-vector of signed integers (16-bit)
+#  define port_memory_write_local_sint16_v8_unaligned         port_memory_write_sint16_v8_unaligned
+#  define port_memory_write_global_sint16_v8_unaligned        port_memory_write_sint16_v8_unaligned
+
+// 16-vector of signed integers (16-bit)
+#  define port_memory_write_local_sint16_v16_unaligned        port_memory_write_sint16_v16_unaligned
+#  define port_memory_write_global_sint16_v16_unaligned       port_memory_write_sint16_v16_unaligned
+
+
+// Signed integer (32-bit)
+#  define port_memory_write_local_sint32_unaligned            port_memory_write_sint32_unaligned
+#  define port_memory_write_global_sint32_unaligned           port_memory_write_sint32_unaligned
+
+// 2-vector of signed integers (32-bit)
+#  define port_memory_write_local_sint32_v2_unaligned         port_memory_write_sint32_v2_unaligned
+#  define port_memory_write_global_sint32_v2_unaligned        port_memory_write_sint32_v2_unaligned
+
+// 3-vector of signed integers (32-bit)
+#  define port_memory_write_local_sint32_v3_unaligned         port_memory_write_sint32_v3_unaligned
+#  define port_memory_write_global_sint32_v3_unaligned        port_memory_write_sint32_v3_unaligned
+
+// 4-vector of signed integers (32-bit)
+#  define port_memory_write_local_sint32_v4_unaligned         port_memory_write_sint32_v4_unaligned
+#  define port_memory_write_global_sint32_v4_unaligned        port_memory_write_sint32_v4_unaligned
+
+// 8-vector of signed integers (32-bit)
+#  define port_memory_write_local_sint32_v8_unaligned         port_memory_write_sint32_v8_unaligned
+#  define port_memory_write_global_sint32_v8_unaligned        port_memory_write_sint32_v8_unaligned
+
+// 16-vector of signed integers (32-bit)
+#  define port_memory_write_local_sint32_v16_unaligned        port_memory_write_sint32_v16_unaligned
+#  define port_memory_write_global_sint32_v16_unaligned       port_memory_write_sint32_v16_unaligned
+
+
+// Signed integer (64-bit)
+#  define port_memory_write_local_sint64_unaligned            port_memory_write_sint64_unaligned
+#  define port_memory_write_global_sint64_unaligned           port_memory_write_sint64_unaligned
+
+// 2-vector of signed integers (64-bit)
+#  define port_memory_write_local_sint64_v2_unaligned         port_memory_write_sint64_v2_unaligned
+#  define port_memory_write_global_sint64_v2_unaligned        port_memory_write_sint64_v2_unaligned
+
+// 3-vector of signed integers (64-bit)
+#  define port_memory_write_local_sint64_v3_unaligned         port_memory_write_sint64_v3_unaligned
+#  define port_memory_write_global_sint64_v3_unaligned        port_memory_write_sint64_v3_unaligned
+
+// 4-vector of signed integers (64-bit)
+#  define port_memory_write_local_sint64_v4_unaligned         port_memory_write_sint64_v4_unaligned
+#  define port_memory_write_global_sint64_v4_unaligned        port_memory_write_sint64_v4_unaligned
+
+// 8-vector of signed integers (64-bit)
+#  define port_memory_write_local_sint64_v8_unaligned         port_memory_write_sint64_v8_unaligned
+#  define port_memory_write_global_sint64_v8_unaligned        port_memory_write_sint64_v8_unaligned
+
+// 16-vector of signed integers (64-bit)
+#  define port_memory_write_local_sint64_v16_unaligned        port_memory_write_sint64_v16_unaligned
+#  define port_memory_write_global_sint64_v16_unaligned       port_memory_write_sint64_v16_unaligned
+
+
+// Floating-point number (16-bit)
+#  define port_memory_write_local_float16_unaligned           port_memory_write_float16_unaligned
+#  define port_memory_write_global_float16_unaligned          port_memory_write_float16_unaligned
+
+// 2-vector of floating-point numbers (16-bit)
+#  define port_memory_write_local_float16_v2_unaligned        port_memory_write_float16_v2_unaligned
+#  define port_memory_write_global_float16_v2_unaligned       port_memory_write_float16_v2_unaligned
+
+// 3-vector of floating-point numbers (16-bit)
+#  define port_memory_write_local_float16_v3_unaligned        port_memory_write_float16_v3_unaligned
+#  define port_memory_write_global_float16_v3_unaligned       port_memory_write_float16_v3_unaligned
+
+// 4-vector of floating-point numbers (16-bit)
+#  define port_memory_write_local_float16_v4_unaligned        port_memory_write_float16_v4_unaligned
+#  define port_memory_write_global_float16_v4_unaligned       port_memory_write_float16_v4_unaligned
+
+// 8-vector of floating-point numbers (16-bit)
+#  define port_memory_write_local_float16_v8_unaligned        port_memory_write_float16_v8_unaligned
+#  define port_memory_write_global_float16_v8_unaligned       port_memory_write_float16_v8_unaligned
+
+// 16-vector of floating-point numbers (16-bit)
+#  define port_memory_write_local_float16_v16_unaligned       port_memory_write_float16_v16_unaligned
+#  define port_memory_write_global_float16_v16_unaligned      port_memory_write_float16_v16_unaligned
+
+
+// Floating-point number (32-bit)
+#  define port_memory_write_local_float32_unaligned           port_memory_write_float32_unaligned
+#  define port_memory_write_global_float32_unaligned          port_memory_write_float32_unaligned
+
+// 2-vector of floating-point numbers (32-bit)
+#  define port_memory_write_local_float32_v2_unaligned        port_memory_write_float32_v2_unaligned
+#  define port_memory_write_global_float32_v2_unaligned       port_memory_write_float32_v2_unaligned
+
+// 3-vector of floating-point numbers (32-bit)
+#  define port_memory_write_local_float32_v3_unaligned        port_memory_write_float32_v3_unaligned
+#  define port_memory_write_global_float32_v3_unaligned       port_memory_write_float32_v3_unaligned
+
+// 4-vector of floating-point numbers (32-bit)
+#  define port_memory_write_local_float32_v4_unaligned        port_memory_write_float32_v4_unaligned
+#  define port_memory_write_global_float32_v4_unaligned       port_memory_write_float32_v4_unaligned
+
+// 8-vector of floating-point numbers (32-bit)
+#  define port_memory_write_local_float32_v8_unaligned        port_memory_write_float32_v8_unaligned
+#  define port_memory_write_global_float32_v8_unaligned       port_memory_write_float32_v8_unaligned
+
+// 16-vector of floating-point numbers (32-bit)
+#  define port_memory_write_local_float32_v16_unaligned       port_memory_write_float32_v16_unaligned
+#  define port_memory_write_global_float32_v16_unaligned      port_memory_write_float32_v16_unaligned
+
+
+// Floating-point number (64-bit)
+#  define port_memory_write_local_float64_unaligned           port_memory_write_float64_unaligned
+#  define port_memory_write_global_float64_unaligned          port_memory_write_float64_unaligned
+
+// 2-vector of floating-point numbers (64-bit)
+#  define port_memory_write_local_float64_v2_unaligned        port_memory_write_float64_v2_unaligned
+#  define port_memory_write_global_float64_v2_unaligned       port_memory_write_float64_v2_unaligned
+
+// 3-vector of floating-point numbers (64-bit)
+#  define port_memory_write_local_float64_v3_unaligned        port_memory_write_float64_v3_unaligned
+#  define port_memory_write_global_float64_v3_unaligned       port_memory_write_float64_v3_unaligned
+
+// 4-vector of floating-point numbers (64-bit)
+#  define port_memory_write_local_float64_v4_unaligned        port_memory_write_float64_v4_unaligned
+#  define port_memory_write_global_float64_v4_unaligned       port_memory_write_float64_v4_unaligned
+
+// 8-vector of floating-point numbers (64-bit)
+#  define port_memory_write_local_float64_v8_unaligned        port_memory_write_float64_v8_unaligned
+#  define port_memory_write_global_float64_v8_unaligned       port_memory_write_float64_v8_unaligned
+
+// 16-vector of floating-point numbers (64-bit)
+#  define port_memory_write_local_float64_v16_unaligned       port_memory_write_float64_v16_unaligned
+#  define port_memory_write_global_float64_v16_unaligned      port_memory_write_float64_v16_unaligned
+
+#endif // __OPENCL_C_VERSION__
+
 ///////////////////////////////////////////////////////////////////////////////
 // Aliases for typedefs of built-in types
 ///////////////////////////////////////////////////////////////////////////////
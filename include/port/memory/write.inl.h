@@ -0,0 +1,366 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Definitions of functions for writing built-in types to memory.
+ *
+ * Definitions are compiled into the library by default.
+ * If PORT_FEATURE_INLINE is defined, they are included by the corresponding
+ * .fun.h header as static inline functions instead.
+ */
+
+#pragma once
+#ifndef _PORT_MEMORY_WRITE_INL_H_
+#define _PORT_MEMORY_WRITE_INL_H_
+
+#include "port/pointer.typ.h"
+
+#ifndef __OPENCL_C_VERSION__
+#  include "port/float.fun.h" // for port_convert_float*()
+#  include <stdint.h> // for uintptr_t
+#  include <string.h> // for memcpy()
+#  include <assert.h>
+#endif
+
+
+#ifdef __OPENCL_C_VERSION__
+#  define ASSERT_MEMORY(type)
+#else
+#  define ASSERT_MEMORY(type) \
+    assert(memory != NULL);   \
+    assert((uintptr_t)memory % sizeof(type) == 0)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Scalars (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+#define DEFINE_WRITE_FUNCTION(type) \
+PORT_INLINE void port_memory_write_##type(port_void_ptr_t memory, size_t offset, port_##type##_t value) \
+{                                                   \
+    ASSERT_MEMORY(port_##type##_t);                 \
+    *((port_##type##_t*)memory + offset) = value;   \
+}
+
+DEFINE_WRITE_FUNCTION(uint8)
+DEFINE_WRITE_FUNCTION(uint16)
+DEFINE_WRITE_FUNCTION(uint32)
+DEFINE_WRITE_FUNCTION(uint64)
+
+DEFINE_WRITE_FUNCTION(sint8)
+DEFINE_WRITE_FUNCTION(sint16)
+DEFINE_WRITE_FUNCTION(sint32)
+DEFINE_WRITE_FUNCTION(sint64)
+
+DEFINE_WRITE_FUNCTION(float32)
+DEFINE_WRITE_FUNCTION(float64)
+
+#undef DEFINE_WRITE_FUNCTION
+
+
+PORT_INLINE void port_memory_write_float16(port_void_ptr_t memory, size_t offset, port_float32_t value)
+{
+#ifdef __OPENCL_C_VERSION__
+    return vstore_half(value, offset, (half*)memory);
+#else
+    ASSERT_MEMORY(port_uint16_t);
+    *((port_uint16_t*)memory + offset) = port_convert_float32_to_float16(value);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Vectors (generic address space)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(type, vlen) \
+PORT_INLINE void port_memory_write_##type##_v##vlen(port_void_ptr_t memory, size_t offset, port_##type##_v##vlen##_t value) \
+{                                                           \
+    vstore##vlen(value, offset, (port_##type##_t*)memory);  \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(type, vlen) \
+PORT_INLINE void port_memory_write_##type##_v##vlen(port_void_ptr_t memory, size_t offset, port_##type##_v##vlen##_t value) \
+{                                                                                       \
+    ASSERT_MEMORY(port_##type##_t);                                                     \
+    memcpy((port_##type##_t*)memory + offset, value.s, vlen * sizeof(port_##type##_t)); \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTIONS(type) \
+    DEFINE_WRITE_FUNCTION(type, 2) \
+    DEFINE_WRITE_FUNCTION(type, 3) \
+    DEFINE_WRITE_FUNCTION(type, 4) \
+    DEFINE_WRITE_FUNCTION(type, 8) \
+    DEFINE_WRITE_FUNCTION(type, 16)
+
+DEFINE_WRITE_FUNCTIONS(uint8)
+DEFINE_WRITE_FUNCTIONS(uint16)
+DEFINE_WRITE_FUNCTIONS(uint32)
+DEFINE_WRITE_FUNCTIONS(uint64)
+
+DEFINE_WRITE_FUNCTIONS(sint8)
+DEFINE_WRITE_FUNCTIONS(sint16)
+DEFINE_WRITE_FUNCTIONS(sint32)
+DEFINE_WRITE_FUNCTIONS(sint64)
+
+DEFINE_WRITE_FUNCTIONS(float32)
+DEFINE_WRITE_FUNCTIONS(float64)
+
+#undef DEFINE_WRITE_FUNCTIONS
+#undef DEFINE_WRITE_FUNCTION
+
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(vlen) \
+PORT_INLINE void port_memory_write_float16_v##vlen(port_void_ptr_t memory, size_t offset, port_float32_v##vlen##_t value) \
+{                                                       \
+    vstore_half##vlen(value, offset, (half*)memory);    \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(vlen) \
+PORT_INLINE void port_memory_write_float16_v##vlen(port_void_ptr_t memory, size_t offset, port_float32_v##vlen##_t value) \
+{                                                                                           \
+    ASSERT_MEMORY(port_uint16_t);                                                           \
+    for (size_t i = 0; i < vlen; i++)                                                       \
+        ((port_uint16_t*)memory + offset)[i] = port_convert_float32_to_float16(value.s[i]); \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+DEFINE_WRITE_FUNCTION(2)
+DEFINE_WRITE_FUNCTION(3)
+DEFINE_WRITE_FUNCTION(4)
+DEFINE_WRITE_FUNCTION(8)
+DEFINE_WRITE_FUNCTION(16)
+
+#undef DEFINE_WRITE_FUNCTION
+
+///////////////////////////////////////////////////////////////////////////////
+// Scalars (named address space)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(type, address_space) \
+PORT_INLINE void port_memory_write_##address_space##_##type( \
+        port_##address_space##_void_ptr_t memory, size_t offset, port_##type##_t value) \
+{                                                                   \
+    *((__##address_space port_##type##_t*)memory + offset) = value; \
+}
+
+#define DEFINE_WRITE_FUNCTIONS(type) \
+    DEFINE_WRITE_FUNCTION(type, local) \
+    DEFINE_WRITE_FUNCTION(type, global)
+
+DEFINE_WRITE_FUNCTIONS(uint8)
+DEFINE_WRITE_FUNCTIONS(uint16)
+DEFINE_WRITE_FUNCTIONS(uint32)
+DEFINE_WRITE_FUNCTIONS(uint64)
+
+DEFINE_WRITE_FUNCTIONS(sint8)
+DEFINE_WRITE_FUNCTIONS(sint16)
+DEFINE_WRITE_FUNCTIONS(sint32)
+DEFINE_WRITE_FUNCTIONS(sint64)
+
+DEFINE_WRITE_FUNCTIONS(float32)
+DEFINE_WRITE_FUNCTIONS(float64)
+
+#undef DEFINE_WRITE_FUNCTIONS
+#undef DEFINE_WRITE_FUNCTION
+
+
+#define DEFINE_WRITE_FUNCTION(address_space) \
+PORT_INLINE void port_memory_write_##address_space##_float16( \
+        port_##address_space##_void_ptr_t memory, size_t offset, port_float32_t value) \
+{                                                                   \
+    vstore_half(value, offset, (__##address_space half*)memory);    \
+}
+
+DEFINE_WRITE_FUNCTION(local)
+DEFINE_WRITE_FUNCTION(global)
+
+#undef DEFINE_WRITE_FUNCTION
+
+#endif // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Vectors (named address space)
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(type, vlen, address_space) \
+PORT_INLINE void port_memory_write_##address_space##_##type##_v##vlen( \
+        port_##address_space##_void_ptr_t memory, size_t offset, port_##type##_v##vlen##_t value) \
+{                                                                               \
+    vstore##vlen(value, offset, (__##address_space port_##type##_t*)memory);    \
+}
+
+#define DEFINE_WRITE_FUNCTIONS(type) \
+    DEFINE_WRITE_FUNCTION(type, 2, local) \
+    DEFINE_WRITE_FUNCTION(type, 2, global) \
+    DEFINE_WRITE_FUNCTION(type, 3, local) \
+    DEFINE_WRITE_FUNCTION(type, 3, global) \
+    DEFINE_WRITE_FUNCTION(type, 4, local) \
+    DEFINE_WRITE_FUNCTION(type, 4, global) \
+    DEFINE_WRITE_FUNCTION(type, 8, local) \
+    DEFINE_WRITE_FUNCTION(type, 8, global) \
+    DEFINE_WRITE_FUNCTION(type, 16, local) \
+    DEFINE_WRITE_FUNCTION(type, 16, global)
+
+DEFINE_WRITE_FUNCTIONS(uint8)
+DEFINE_WRITE_FUNCTIONS(uint16)
+DEFINE_WRITE_FUNCTIONS(uint32)
+DEFINE_WRITE_FUNCTIONS(uint64)
+
+DEFINE_WRITE_FUNCTIONS(sint8)
+DEFINE_WRITE_FUNCTIONS(sint16)
+DEFINE_WRITE_FUNCTIONS(sint32)
+DEFINE_WRITE_FUNCTIONS(sint64)
+
+DEFINE_WRITE_FUNCTIONS(float32)
+DEFINE_WRITE_FUNCTIONS(float64)
+
+#undef DEFINE_WRITE_FUNCTIONS
+#undef DEFINE_WRITE_FUNCTION
+
+
+#define DEFINE_WRITE_FUNCTION(vlen, address_space) \
+PORT_INLINE void port_memory_write_##address_space##_float16_v##vlen( \
+        port_##address_space##_void_ptr_t memory, size_t offset, port_float32_v##vlen##_t value) \
+{                                                                       \
+    vstore_half##vlen(value, offset, (__##address_space half*)memory);  \
+}
+
+#define DEFINE_WRITE_FUNCTIONS(vlen) \
+    DEFINE_WRITE_FUNCTION(vlen, local) \
+    DEFINE_WRITE_FUNCTION(vlen, global)
+
+DEFINE_WRITE_FUNCTIONS(2)
+DEFINE_WRITE_FUNCTIONS(3)
+DEFINE_WRITE_FUNCTIONS(4)
+DEFINE_WRITE_FUNCTIONS(8)
+DEFINE_WRITE_FUNCTIONS(16)
+
+#undef DEFINE_WRITE_FUNCTIONS
+#undef DEFINE_WRITE_FUNCTION
+
+#endif // __OPENCL_C_VERSION__
+
+///////////////////////////////////////////////////////////////////////////////
+// Unaligned access (all address spaces)
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * On CPU, memcpy() of a constant size compiles to unaligned stores.
+ * OpenCL has no unaligned stores, so values are stored byte by byte from private memory.
+ */
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(type, suffix, num_elements, address_space, qualifier) \
+PORT_INLINE void port_memory_write##address_space##_##type##suffix##_unaligned( \
+        port##address_space##_void_ptr_t memory, size_t offset, port_##type##suffix##_t value) \
+{                                                                                                   \
+    for (size_t i = 0; i < num_elements * sizeof(port_##type##_t); i++)                             \
+        ((qualifier port_uint8_t*)memory)[offset + i] = ((const __private port_uint8_t*)&value)[i]; \
+}
+
+#define DEFINE_FLOAT16_WRITE_FUNCTION(suffix, vlen, num_elements, address_space, qualifier) \
+PORT_INLINE void port_memory_write##address_space##_float16##suffix##_unaligned( \
+        port##address_space##_void_ptr_t memory, size_t offset, port_float32##suffix##_t value) \
+{                                                                                                 \
+    port_uint16_t bits[num_elements];                                                             \
+    vstore_half##vlen(value, 0, (__private half*)bits);                                           \
+    for (size_t i = 0; i < sizeof(bits); i++)                                                     \
+        ((qualifier port_uint8_t*)memory)[offset + i] = ((const __private port_uint8_t*)bits)[i]; \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTION(type, suffix, num_elements, address_space, qualifier) \
+PORT_INLINE void port_memory_write_##type##suffix##_unaligned( \
+        port_void_ptr_t memory, size_t offset, port_##type##suffix##_t value) \
+{                                                                                   \
+    assert(memory != NULL);                                                         \
+    memcpy((char*)memory + offset, &value, num_elements * sizeof(port_##type##_t)); \
+}
+
+#define DEFINE_FLOAT16_WRITE_FUNCTION(suffix, vlen, num_elements, address_space, qualifier) \
+PORT_INLINE void port_memory_write_float16##suffix##_unaligned( \
+        port_void_ptr_t memory, size_t offset, port_float32##suffix##_t value) \
+{                                                                                      \
+    assert(memory != NULL);                                                            \
+    port_uint16_t bits[num_elements];                                                  \
+    for (size_t i = 0; i < num_elements; i++)                                          \
+        bits[i] = port_convert_float32_to_float16(((const port_float32_t*)&value)[i]); \
+    memcpy((char*)memory + offset, bits, sizeof(bits));                                \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+#define DEFINE_WRITE_FUNCTIONS_FOR_TYPE(type, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTION(type, , 1, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTION(type, _v2, 2, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTION(type, _v3, 3, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTION(type, _v4, 4, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTION(type, _v8, 8, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTION(type, _v16, 16, address_space, qualifier)
+
+#define DEFINE_WRITE_FUNCTIONS(address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(uint8, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(uint16, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(uint32, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(uint64, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(sint8, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(sint16, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(sint32, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(sint64, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(float32, address_space, qualifier) \
+    DEFINE_WRITE_FUNCTIONS_FOR_TYPE(float64, address_space, qualifier) \
+    DEFINE_FLOAT16_WRITE_FUNCTION(, , 1, address_space, qualifier) \
+    DEFINE_FLOAT16_WRITE_FUNCTION(_v2, 2, 2, address_space, qualifier) \
+    DEFINE_FLOAT16_WRITE_FUNCTION(_v3, 3, 3, address_space, qualifier) \
+    DEFINE_FLOAT16_WRITE_FUNCTION(_v4, 4, 4, address_space, qualifier) \
+    DEFINE_FLOAT16_WRITE_FUNCTION(_v8, 8, 8, address_space, qualifier) \
+    DEFINE_FLOAT16_WRITE_FUNCTION(_v16, 16, 16, address_space, qualifier)
+
+DEFINE_WRITE_FUNCTIONS(, )
+#ifdef __OPENCL_C_VERSION__
+DEFINE_WRITE_FUNCTIONS(_local, __local)
+DEFINE_WRITE_FUNCTIONS(_global, __global)
+#endif
+
+#undef DEFINE_WRITE_FUNCTIONS
+#undef DEFINE_WRITE_FUNCTIONS_FOR_TYPE
+#undef DEFINE_FLOAT16_WRITE_FUNCTION
+#undef DEFINE_WRITE_FUNCTION
+
+#undef ASSERT_MEMORY
+
+#endif // _PORT_MEMORY_WRITE_INL_H_
@@ -0,0 +1,232 @@
+ ############################################################################
+ # Copyright (C) 2020-2026 by Ivan Podmazov                                 #
+ #                                                                          #
+ # This file is part of Port.                                               #
+ #                                                                          #
+ #   Port is free software: you can redistribute it and/or modify it        #
+ #   under the terms of the GNU Lesser General Public License as published  #
+ #   by the Free Software Foundation, either version 3 of the License, or   #
+ #   (at your option) any later version.                                    #
+ #                                                                          #
+ #   Port is distributed in the hope that it will be useful,                #
+ #   but WITHOUT ANY WARRANTY; without even the implied warranty of         #
+ #   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          #
+ #   GNU Lesser General Public License for more details.                    #
+ #                                                                          #
+ #   You should have received a copy of the GNU Lesser General Public       #
+ #   License along with Port. If not, see <http://www.gnu.org/licenses/>.   #
+ ############################################################################
+
+##
+# @file
+# @brief Generator of packed record layouts with typed accessors.
+#
+
+import sys
+import json
+
+###################
+### Field types ###
+###################
+
+# Type name -> (size in bytes, C value type)
+_TYPES = {}
+
+for _name, _size in [('quarter', 1), ('half', 2), ('single', 4), ('double', 8)]:
+    _TYPES[f'uint_{_name}'] = (_size, f'port_uint_{_name}_t')
+    _TYPES[f'sint_{_name}'] = (_size, f'port_sint_{_name}_t')
+    _TYPES[f'uint{8 * _size}'] = (_size, f'port_uint{8 * _size}_t')
+    _TYPES[f'sint{8 * _size}'] = (_size, f'port_sint{8 * _size}_t')
+
+_TYPES['float_half'] = (2, 'port_float_single_t') # converted on access
+_TYPES['float_single'] = (4, 'port_float_single_t')
+_TYPES['float_double'] = (8, 'port_float_double_t')
+_TYPES['float16'] = (2, 'port_float32_t') # converted on access
+_TYPES['float32'] = (4, 'port_float32_t')
+_TYPES['float64'] = (8, 'port_float64_t')
+
+_TYPES['memory_ref'] = (4, 'port_memory_ref_t')
+_TYPES['memory_ref_half'] = (2, 'port_memory_ref_half_t')
+_TYPES['memory_ref_quarter'] = (1, 'port_memory_ref_quarter_t')
+
+UNIT_SIZE = 4 # size of memory unit in bytes
+
+##############
+### Layout ###
+##############
+
+class Field:
+    """Record field: a scalar or a fixed-size array of scalars.
+    """
+    def __init__(self, name, type, count=1, /):
+        if type not in _TYPES:
+            raise ValueError(f"Unknown field type '{type}'")
+        elif count < 1:
+            raise ValueError("Field must have at least one element")
+
+        self.name = name
+        self.type = type
+        self.count = count
+        self.offset = None # in bytes, assigned by layout()
+
+    @property
+    def element_size(self):
+        return _TYPES[self.type][0]
+
+    @property
+    def size(self):
+        return self.element_size * self.count
+
+    @property
+    def value_type(self):
+        return _TYPES[self.type][1]
+
+
+class Layout:
+    """Packed record layout.
+
+    Fields are placed in the order of decreasing element size, which gives
+    every field its natural alignment without any padding between fields.
+    Record size is rounded up to whole units (to double units if the record has
+    double size fields, so that they stay aligned in arrays of records).
+    """
+    def __init__(self, name, fields, /):
+        self.name = name
+        self.fields = [field if isinstance(field, Field) else Field(*field) for field in fields]
+
+        names = [field.name for field in self.fields]
+        if len(set(names)) != len(names):
+            raise ValueError("Field names must be unique")
+
+        offset = 0
+        for field in sorted(self.fields, key=lambda field: -field.element_size): # sort is stable
+            field.offset = offset
+            offset += field.size
+
+        self.num_bytes = offset
+
+        self.alignment = UNIT_SIZE
+        if any(field.element_size > UNIT_SIZE for field in self.fields):
+            self.alignment = 2 * UNIT_SIZE
+
+        self.num_units = -(-offset // self.alignment) * self.alignment // UNIT_SIZE
+
+    def __getitem__(self, name):
+        for field in self.fields:
+            if field.name == name:
+                return field
+
+        raise KeyError(name)
+
+    ##################
+    ### Generation ###
+    ##################
+
+    def _accessors(self, address_space=None):
+        prefix = self.name
+        space = f'{address_space}_' if address_space is not None else ''
+        const_ptr = f'port_const_{space}void_ptr_t' if address_space != 'constant' else 'port_constant_void_ptr_t'
+        ptr = f'port_{space}void_ptr_t'
+
+        lines = []
+        for field in self.fields:
+            offset = field.offset // field.element_size
+            index = ', size_t index' if field.count > 1 else ''
+            offset_expr = f'{offset} + index' if field.count > 1 else f'{offset}'
+
+            lines.append(f'static inline {field.value_type} {prefix}_get_{space}{field.name}({const_ptr} record{index})')
+            lines.append(f'{{ return port_memory_read_{space}{field.type}(record, {offset_expr}); }}')
+
+            if address_space != 'constant':
+                lines.append(f'static inline void {prefix}_set_{space}{field.name}({ptr} record{index}, {field.value_type} value)')
+                lines.append(f'{{ port_memory_write_{space}{field.type}(record, {offset_expr}, value); }}')
+
+            lines.append('')
+
+        return lines
+
+    def _aliases(self, address_space):
+        prefix = self.name
+        space = f'{address_space}_'
+
+        lines = []
+        for field in self.fields:
+            lines.append(f'#  define {prefix}_get_{space}{field.name} {prefix}_get_{field.name}')
+
+            if address_space != 'constant':
+                lines.append(f'#  define {prefix}_set_{space}{field.name} {prefix}_set_{field.name}')
+
+        lines.append('')
+        return lines
+
+    def generate(self, address_spaces=('local', 'global', 'constant')):
+        """Generate C header with layout constants and accessors.
+
+        Accessors for named address spaces are generated for OpenCL,
+        on CPU their names are aliases of generic accessors.
+        """
+        guard = f'_{self.name.upper()}_LAYOUT_H_'
+        macro = self.name.upper()
+
+        lines = ['/**',
+                 ' * @file',
+                 f' * @brief Layout of {self.name} records (generated by port.layout).',
+                 ' */',
+                 '',
+                 '#pragma once',
+                 f'#ifndef {guard}',
+                 f'#define {guard}',
+                 '',
+                 '#include "port/memory/read.fun.h"',
+                 '#include "port/memory/write.fun.h"',
+                 '#include "port/memory.typ.h"',
+                 '',
+                 f'#define {macro}_NUM_UNITS {self.num_units} ///< Record size in units.',
+                 f'#define {macro}_ALIGNMENT {self.alignment} ///< Required record alignment in bytes.',
+                 '']
+
+        for field in self.fields:
+            lines.append(f'#define {macro}_OFFSET_{field.name.upper()} {field.offset} ///< Offset of field in bytes.')
+
+        lines.append('')
+        lines += self._accessors()
+
+        if address_spaces:
+            lines.append('#ifdef __OPENCL_C_VERSION__')
+            lines.append('')
+            for address_space in address_spaces:
+                lines += self._accessors(address_space)
+            lines.append('#else // __OPENCL_C_VERSION__')
+            lines.append('')
+            for address_space in address_spaces:
+                lines += self._aliases(address_space)
+            lines.append('#endif // __OPENCL_C_VERSION__')
+            lines.append('')
+
+        lines.append(f'#endif // {guard}')
+        lines.append('')
+
+        return '\n'.join(lines)
+
+############
+### Main ###
+############
+
+def main(argv=None):
+    """Generate header from JSON description of a record:
+    {"name": "my_record", "fields": [["field", "type", count], ...]}
+    """
+    argv = sys.argv[1:] if argv is None else argv
+    if len(argv) != 1:
+        print(f"Usage: python -m port.layout <description.json>", file=sys.stderr)
+        return 1
+
+    with open(argv[0]) as file:
+        description = json.load(file)
+
+    layout = Layout(description['name'], description['fields'])
+    sys.stdout.write(layout.generate())
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
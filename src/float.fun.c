@@ -33,6 +33,11 @@
 #  include <assert.h>
 #endif
 
+#if !defined(__OPENCL_C_VERSION__) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#  define F16_ARRAY_X86 // F16C and AVX-512 conversions for arrays
+#  include <immintrin.h>
+#endif
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Miscellaneous functions
@@ -500,12 +505,84 @@ port_float64_multi_product(
 #define F32_EXP_BIAS 0x7F // exponent bias
 #define F32_EXP_INF 0xFF  // exponent value for infinity and NaN
 
+#if !defined(__OPENCL_C_VERSION__) && defined(PORT_FEATURE_FLOAT16_TABLE)
+
+/*
+ * Table-driven conversion (J. van der Zijp, "Fast Half Float Conversions"):
+ *
+ * float32 bits = mantissa_table[offset_table[h >> 10] + (h & 0x3FF)] + exponent_table[h >> 10],
+ *
+ * where h >> 10 is the sign and the exponent of a float16 number.
+ * Tables are built by the preprocessor, so they are constant and need no initialization.
+ */
+
+// number of leading zeros of non-zero subnormal mantissa in a 10-bit field, plus one
+#define F16_SUBNORMAL_SHIFT(m) \
+    ((m) >= 0x200 ? 1 : (m) >= 0x100 ? 2 : (m) >= 0x080 ? 3 : (m) >= 0x040 ? 4 : (m) >= 0x020 ? 5 : \
+     (m) >= 0x010 ? 6 : (m) >= 0x008 ? 7 : (m) >= 0x004 ? 8 : (m) >= 0x002 ? 9 : 10)
+
+// subnormal mantissas are normalized, normal mantissas are shifted and biased by 112 << 23,
+// infinity and NaN mantissas are shifted and biased the same way, with quiet bit set for NaNs
+#define F16_MANTISSA(i) \
+    ((i) == 0 ? 0u : \
+     (i) < PORT_BIT32(F16_MNT_NBITS) ? \
+        ((((port_uint32_t)(i) << ((F32_MNT_NBITS - F16_MNT_NBITS) + F16_SUBNORMAL_SHIFT(i))) & \
+          PORT_NZMASK32(F32_MNT_NBITS)) | \
+         ((port_uint32_t)(F32_EXP_BIAS - F16_EXP_BIAS + 1 - F16_SUBNORMAL_SHIFT(i)) << F32_MNT_NBITS)) : \
+     (i) < PORT_BIT32(F16_MNT_NBITS + 1) ? \
+        ((port_uint32_t)(F32_EXP_BIAS - F16_EXP_BIAS) << F32_MNT_NBITS) + \
+         ((port_uint32_t)((i) - PORT_BIT32(F16_MNT_NBITS)) << (F32_MNT_NBITS - F16_MNT_NBITS)) : \
+        ((port_uint32_t)(F32_EXP_BIAS - F16_EXP_BIAS) << F32_MNT_NBITS) + \
+         ((port_uint32_t)(((i) - PORT_BIT32(F16_MNT_NBITS + 1)) | \
+          ((i) != PORT_BIT32(F16_MNT_NBITS + 1) ? PORT_BIT32(F16_MNT_NBITS - 1) : 0)) << \
+          (F32_MNT_NBITS - F16_MNT_NBITS)))
+
+// exponent 31 maps to 255 - 112, mantissa table adds the rest of the bias
+#define F16_EXPONENT(i) \
+    (((port_uint32_t)((i) >> F16_EXP_NBITS) << F32_SGN_BITP) | \
+     (((i) & PORT_NZMASK32(F16_EXP_NBITS)) == F16_EXP_INF ? \
+        (port_uint32_t)(F32_EXP_INF - (F32_EXP_BIAS - F16_EXP_BIAS)) << F32_MNT_NBITS : \
+        (port_uint32_t)((i) & PORT_NZMASK32(F16_EXP_NBITS)) << F32_MNT_NBITS))
+
+// zero exponent selects zero and subnormal mantissas, exponent 31 selects infinity and NaN mantissas
+#define F16_OFFSET(i) \
+    (((i) & PORT_NZMASK32(F16_EXP_NBITS)) == 0 ? 0 : \
+     ((i) & PORT_NZMASK32(F16_EXP_NBITS)) == F16_EXP_INF ? PORT_BIT32(F16_MNT_NBITS + 1) : \
+        PORT_BIT32(F16_MNT_NBITS))
+
+#define F16_TABLE_2(f, i)    f(i), f((i) + 1)
+#define F16_TABLE_4(f, i)    F16_TABLE_2(f, i), F16_TABLE_2(f, (i) + 2)
+#define F16_TABLE_8(f, i)    F16_TABLE_4(f, i), F16_TABLE_4(f, (i) + 4)
+#define F16_TABLE_16(f, i)   F16_TABLE_8(f, i), F16_TABLE_8(f, (i) + 8)
+#define F16_TABLE_32(f, i)   F16_TABLE_16(f, i), F16_TABLE_16(f, (i) + 16)
+#define F16_TABLE_64(f, i)   F16_TABLE_32(f, i), F16_TABLE_32(f, (i) + 32)
+#define F16_TABLE_128(f, i)  F16_TABLE_64(f, i), F16_TABLE_64(f, (i) + 64)
+#define F16_TABLE_256(f, i)  F16_TABLE_128(f, i), F16_TABLE_128(f, (i) + 128)
+#define F16_TABLE_512(f, i)  F16_TABLE_256(f, i), F16_TABLE_256(f, (i) + 256)
+#define F16_TABLE_1024(f, i) F16_TABLE_512(f, i), F16_TABLE_512(f, (i) + 512)
+#define F16_TABLE_2048(f, i) F16_TABLE_1024(f, i), F16_TABLE_1024(f, (i) + 1024)
+
+static const port_uint32_t f16_mantissa_table[3072] = {
+    F16_TABLE_2048(F16_MANTISSA, 0), F16_TABLE_1024(F16_MANTISSA, 2048)};
+static const port_uint32_t f16_exponent_table[64] = {F16_TABLE_64(F16_EXPONENT, 0)};
+static const port_uint16_t f16_offset_table[64] = {F16_TABLE_64(F16_OFFSET, 0)};
+
+#endif
+
 port_float32_t
 port_convert_float16_to_float32(
         port_uint16_t value)
 {
 #ifdef __OPENCL_C_VERSION__
     return vload_half(0, (half*)&value);
+#elif defined(PORT_FEATURE_FLOAT16_TABLE)
+    union {
+        port_uint32_t as_uint;
+        port_float32_t as_float;
+    } u = {.as_uint = f16_mantissa_table[f16_offset_table[value >> F16_MNT_NBITS] +
+        (value & PORT_NZMASK16(F16_MNT_NBITS))] + f16_exponent_table[value >> F16_MNT_NBITS]};
+
+    return u.as_float;
 #elif defined(__GNUC__)
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wpedantic"
@@ -764,3 +841,113 @@ port_convert_float32_to_float16_v16(
     return v;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Array conversions
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef F16_ARRAY_X86
+
+/*
+ * Conversion instructions are enabled per function, so the library runs on CPUs without them.
+ * Functions convert the longest prefix of whole vectors and return its length.
+ */
+
+__attribute__((target("avx512f")))
+static size_t
+convert_float16_array_to_float32_avx512(
+        port_float32_t *dst,
+        const port_uint16_t *src,
+        size_t num_values)
+{
+    size_t i = 0;
+    for (; i + 16 <= num_values; i += 16)
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(src + i))));
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+static size_t
+convert_float16_array_to_float32_f16c(
+        port_float32_t *dst,
+        const port_uint16_t *src,
+        size_t num_values)
+{
+    size_t i = 0;
+    for (; i + 8 <= num_values; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t
+convert_float32_array_to_float16_avx512(
+        port_uint16_t *dst,
+        const port_float32_t *src,
+        size_t num_values)
+{
+    size_t i = 0;
+    for (; i + 16 <= num_values; i += 16)
+        _mm256_storeu_si256((__m256i*)(dst + i),
+                _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+static size_t
+convert_float32_array_to_float16_f16c(
+        port_uint16_t *dst,
+        const port_float32_t *src,
+        size_t num_values)
+{
+    size_t i = 0;
+    for (; i + 8 <= num_values; i += 8)
+        _mm_storeu_si128((__m128i*)(dst + i),
+                _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    return i;
+}
+
+#endif // F16_ARRAY_X86
+
+void
+port_convert_float16_array_to_float32(
+        port_float32_t *dst,
+        const port_uint16_t *src,
+        size_t num_values)
+{
+    size_t i = 0;
+
+#ifdef __OPENCL_C_VERSION__
+    for (; i + 16 <= num_values; i += 16)
+        vstore16(vload_half16(i / 16, (const half*)src), i / 16, dst);
+#elif defined(F16_ARRAY_X86)
+    if (__builtin_cpu_supports("avx512f"))
+        i = convert_float16_array_to_float32_avx512(dst, src, num_values);
+    else if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c"))
+        i = convert_float16_array_to_float32_f16c(dst, src, num_values);
+#endif
+
+    for (; i < num_values; i++)
+        dst[i] = port_convert_float16_to_float32(src[i]);
+}
+
+void
+port_convert_float32_array_to_float16(
+        port_uint16_t *dst,
+        const port_float32_t *src,
+        size_t num_values)
+{
+    size_t i = 0;
+
+#ifdef __OPENCL_C_VERSION__
+    for (; i + 16 <= num_values; i += 16)
+        vstore_half16_rte(vload16(i / 16, src), i / 16, (half*)dst);
+#elif defined(F16_ARRAY_X86)
+    if (__builtin_cpu_supports("avx512f"))
+        i = convert_float32_array_to_float16_avx512(dst, src, num_values);
+    else if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c"))
+        i = convert_float32_array_to_float16_f16c(dst, src, num_values);
+#endif
+
+    for (; i < num_values; i++)
+        dst[i] = port_convert_float32_to_float16(src[i]);
+}
@@ -24,10 +24,22 @@
 
 #include "port/memory.fun.h"
 #include "port/memory.def.h"
+#include "port/bit.def.h"
+
+#ifndef PORT_FEATURE_INLINE
+#  include "port/memory.inl.h"
+#endif
+
+#if defined(PORT_FEATURE_MEMORY_PROFILE) && !defined(__OPENCL_C_VERSION__)
+#  include "port/memory/profile.fun.h"
+#endif
 
 #ifndef __OPENCL_C_VERSION__
-#  ifndef NDEBUG
-#    include "port/bit.def.h"
+#  include <stdint.h> // for uintptr_t, SIZE_MAX
+
+#  if defined(__AVX2__) && (SIZE_MAX == UINT64_MAX)
+#    include <immintrin.h>
+#    define AVX2_BATCH
 #  endif
 
 #  include <assert.h>
@@ -36,76 +48,324 @@
 
 #if !defined(__OPENCL_C_VERSION__) && !defined(NDEBUG)
 
-#  define ASSERTS \
-    assert(format.far.num_tidx_bits < PORT_NUM_BITS(port_memory_ref_t)); \
+#  define ASSERT_REF(ref) \
     if (PORT_MEMORY_REF_IS_FAR(ref)) { \
         size_t offset = PORT_MEMORY_REF_FAR__OFFSET(ref, format.far.num_tidx_bits); \
         assert(((offset << format.far.offset_lshift) >> format.far.offset_lshift) == offset); \
     } else { \
         size_t offset = -(size_t)ref; \
         assert(((offset << format.near.offset_lshift) >> format.near.offset_lshift) == offset); \
-    } \
-    assert(memory_table != NULL);
+    }
+
+#  define ASSERTS_REFS(table) \
+    assert(format.far.num_tidx_bits < PORT_NUM_BITS(port_memory_ref_t)); \
+    assert((refs != NULL) || (num_refs == 0)); \
+    assert(table != NULL); \
+    for (size_t i = 0; i < num_refs; i++) { \
+        ASSERT_REF(refs[i]) \
+    }
+
+#  define ASSERTS_BATCH(table, out) \
+    ASSERTS_REFS(table) \
+    assert((out != NULL) || (num_refs == 0));
 
 #else
 
-#  define ASSERTS
+#  define ASSERTS_REFS(table)
+#  define ASSERTS_BATCH(table, out)
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Reference encoding
+///////////////////////////////////////////////////////////////////////////////
+
+bool
+port_memory_ref_encode_near(
+        size_t offset,
+        port_memory_ref_format_t format,
+
+        port_memory_ref_t *ref)
+{
+    if ((offset == 0) || ((offset & PORT_DOUBLE_ZMASK(format.near.offset_lshift)) != 0))
+        return false;
+
+    size_t value = offset >> format.near.offset_lshift;
+    if (value - 1 > (size_t)PORT_SINGLE_ZMASK(PORT_NUM_BITS(port_memory_ref_t) - 1))
+        return false;
+
+    if (ref != NULL)
+        *ref = -(port_memory_ref_t)(value - 1) - 1;
+
+    return true;
+}
+
+bool
+port_memory_ref_encode_far(
+        port_uint32_t table_index,
+        size_t offset,
+        port_memory_ref_format_t format,
+
+        port_memory_ref_t *ref)
+{
+    if ((table_index >> format.far.num_tidx_bits) != 0)
+        return false;
+    else if ((offset & PORT_DOUBLE_ZMASK(format.far.offset_lshift)) != 0)
+        return false;
+
+    size_t value = offset >> format.far.offset_lshift;
+    if ((value >> (PORT_NUM_BITS(port_memory_ref_t) - 1 - format.far.num_tidx_bits)) != 0)
+        return false;
+
+    if (ref != NULL)
+        *ref = PORT_MEMORY_REF_FAR(port_memory_ref_t, format.far.num_tidx_bits, table_index, value);
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Batched reference resolution
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef AVX2_BATCH
+
+/*
+ * Resolve 4 references to 64-bit addresses (or offsets).
+ * Near references gather table entry 0 instead of an arbitrary one,
+ * so the table is never accessed out of bounds.
+ */
+static inline __m256i
+resolve4(
+        __m128i refs,
+        port_memory_ref_format_t format,
+        __m256i base,
+        const void *table)
+{
+    const __m128i far_mask = _mm_cmpgt_epi32(refs, _mm_set1_epi32(-1));
+
+    const __m128i tidx = _mm_and_si128(far_mask, _mm_and_si128(refs,
+                _mm_set1_epi32(PORT_SINGLE_ZMASK(format.far.num_tidx_bits))));
+
+    __m256i far = _mm256_i32gather_epi64((const long long*)table, tidx, sizeof(port_uint64_t));
+    far = _mm256_add_epi64(far, _mm256_sll_epi64(
+                _mm256_cvtepu32_epi64(_mm_srl_epi32(refs, _mm_cvtsi32_si128(format.far.num_tidx_bits))),
+                _mm_cvtsi32_si128(format.far.offset_lshift)));
+
+    __m256i near = _mm256_add_epi64(base, _mm256_sll_epi64(
+                _mm256_cvtepu32_epi64(_mm_sub_epi32(_mm_setzero_si128(), refs)),
+                _mm_cvtsi32_si128(format.near.offset_lshift)));
+
+    return _mm256_blendv_epi8(near, far, _mm256_cvtepi32_epi64(far_mask));
+}
+
+#endif // AVX2_BATCH
+
+void
+port_memory_at_batch(
+        const port_memory_ref_t refs[],
+        size_t num_refs,
+        port_memory_ref_format_t format,
+
+        port_const_void_ptr_t base_ptr,
+        const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table,
+
+        port_const_void_ptr_t ptrs[])
+{
+    ASSERTS_BATCH(memory_table, ptrs);
 
+    port_const_char_ptr_t base = (base_ptr != NULL) ? base_ptr : memory_table[0];
+    size_t i = 0;
+
+#ifdef AVX2_BATCH
+    const __m256i base_v = _mm256_set1_epi64x((long long)(uintptr_t)base);
+
+    for (; i + 4 <= num_refs; i += 4)
+        _mm256_storeu_si256((__m256i*)(ptrs + i),
+                resolve4(_mm_loadu_si128((const __m128i*)(refs + i)), format, base_v, memory_table));
 #endif
 
-port_const_void_ptr_t
-port_memory_at(
-        port_memory_ref_t ref,
+    for (; i < num_refs; i++)
+        ptrs[i] = PORT_MEMORY_AT(refs[i], format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
+                base, (const PORT_KW_CONSTANT port_const_char_ptr_t*)memory_table);
+
+#if defined(PORT_FEATURE_MEMORY_PROFILE) && !defined(__OPENCL_C_VERSION__)
+    for (i = 0; i < num_refs; i++)
+        port_memory_profile_record(refs[i], format, ptrs[i]);
+#endif
+}
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_AT_BATCH_FUNCTION(address_space, ptr_type, char_ptr_type) \
+void port_memory_at_batch_##address_space( \
+        const port_memory_ref_t refs[], size_t num_refs, port_memory_ref_format_t format, \
+        ptr_type base_ptr, const PORT_KW_CONSTANT ptr_type *memory_table, ptr_type ptrs[]) \
+{                                                                                               \
+    char_ptr_type base = (base_ptr != NULL) ? (char_ptr_type)base_ptr : (char_ptr_type)memory_table[0]; \
+                                                                                                \
+    for (size_t i = 0; i < num_refs; i++)                                                       \
+        ptrs[i] = PORT_MEMORY_AT(refs[i], format.far.num_tidx_bits, format.far.offset_lshift,  \
+                format.near.offset_lshift, base, (const PORT_KW_CONSTANT char_ptr_type*)memory_table); \
+}
+
+DEFINE_AT_BATCH_FUNCTION(local, port_const_local_void_ptr_t, port_const_local_char_ptr_t)
+DEFINE_AT_BATCH_FUNCTION(global, port_const_global_void_ptr_t, port_const_global_char_ptr_t)
+DEFINE_AT_BATCH_FUNCTION(constant, port_constant_void_ptr_t, port_constant_char_ptr_t)
+
+#undef DEFINE_AT_BATCH_FUNCTION
+
+#endif // __OPENCL_C_VERSION__
+
+void
+port_memory_offset_batch(
+        const port_memory_ref_t refs[],
+        size_t num_refs,
+        port_memory_ref_format_t format,
+
+        size_t base_offset,
+        const PORT_KW_CONSTANT size_t *offset_table,
+
+        size_t offsets[])
+{
+    ASSERTS_BATCH(offset_table, offsets);
+
+    size_t i = 0;
+
+#ifdef AVX2_BATCH
+    const __m256i base_v = _mm256_set1_epi64x((long long)base_offset);
+
+    for (; i + 4 <= num_refs; i += 4)
+        _mm256_storeu_si256((__m256i*)(offsets + i),
+                resolve4(_mm_loadu_si128((const __m128i*)(refs + i)), format, base_v, offset_table));
+#endif
+
+    for (; i < num_refs; i++)
+    {
+        port_memory_ref_t ref = refs[i];
+
+        offsets[i] = PORT_MEMORY_REF_IS_FAR(ref) ?
+            PORT_MEMORY_FAR_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, offset_table) :
+            base_offset + ((-(size_t)ref) << format.near.offset_lshift);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Prefetching
+///////////////////////////////////////////////////////////////////////////////
+
+void
+port_memory_prefetch_batch(
+        const port_memory_ref_t refs[],
+        size_t num_refs,
         port_memory_ref_format_t format,
 
         port_const_void_ptr_t base_ptr,
         const PORT_KW_CONSTANT port_const_void_ptr_t *memory_table)
 {
-    ASSERTS;
-    return PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
-            (port_const_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_const_char_ptr_t*)memory_table);
+    ASSERTS_REFS(memory_table);
+
+#if defined(__GNUC__) && !defined(__OPENCL_C_VERSION__)
+    port_const_char_ptr_t base = (base_ptr != NULL) ? base_ptr : memory_table[0];
+
+    for (size_t i = 0; i < num_refs; i++)
+        __builtin_prefetch(PORT_MEMORY_AT(refs[i], format.far.num_tidx_bits, format.far.offset_lshift,
+                    format.near.offset_lshift, base, (const PORT_KW_CONSTANT port_const_char_ptr_t*)memory_table));
+#else
+    (void) refs;
+    (void) num_refs;
+    (void) format;
+    (void) base_ptr;
+    (void) memory_table;
+#endif
 }
 
 #ifdef __OPENCL_C_VERSION__
 
-port_const_local_void_ptr_t
-port_memory_at_local(
-        port_memory_ref_t ref,
+void
+port_memory_prefetch_batch_local(
+        const port_memory_ref_t refs[],
+        size_t num_refs,
         port_memory_ref_format_t format,
 
         port_const_local_void_ptr_t base_ptr,
         const PORT_KW_CONSTANT port_const_local_void_ptr_t *memory_table)
 {
-    ASSERTS;
-    return PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
-            (port_const_local_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_const_local_char_ptr_t*)memory_table);
+    (void) refs;
+    (void) num_refs;
+    (void) format;
+    (void) base_ptr;
+    (void) memory_table;
 }
 
-port_const_global_void_ptr_t
-port_memory_at_global(
-        port_memory_ref_t ref,
+void
+port_memory_prefetch_batch_global(
+        const port_memory_ref_t refs[],
+        size_t num_refs,
         port_memory_ref_format_t format,
 
         port_const_global_void_ptr_t base_ptr,
         const PORT_KW_CONSTANT port_const_global_void_ptr_t *memory_table)
 {
-    ASSERTS;
-    return PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
-            (port_const_global_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_const_global_char_ptr_t*)memory_table);
+    port_const_global_char_ptr_t base = (base_ptr != NULL) ?
+        (port_const_global_char_ptr_t)base_ptr : (port_const_global_char_ptr_t)memory_table[0];
+
+    for (size_t i = 0; i < num_refs; i++)
+        prefetch((const __global port_uint_single_t*)PORT_MEMORY_AT(refs[i], format.far.num_tidx_bits,
+                    format.far.offset_lshift, format.near.offset_lshift, base,
+                    (const PORT_KW_CONSTANT port_const_global_char_ptr_t*)memory_table), 1);
 }
 
-port_constant_void_ptr_t
-port_memory_at_constant(
-        port_memory_ref_t ref,
+void
+port_memory_prefetch_batch_constant(
+        const port_memory_ref_t refs[],
+        size_t num_refs,
         port_memory_ref_format_t format,
 
         port_constant_void_ptr_t base_ptr,
         const PORT_KW_CONSTANT port_constant_void_ptr_t *memory_table)
 {
-    ASSERTS;
-    return PORT_MEMORY_AT(ref, format.far.num_tidx_bits, format.far.offset_lshift, format.near.offset_lshift,
-            (port_constant_char_ptr_t)base_ptr, (const PORT_KW_CONSTANT port_constant_char_ptr_t*)memory_table);
+    (void) refs;
+    (void) num_refs;
+    (void) format;
+    (void) base_ptr;
+    (void) memory_table;
+}
+
+#endif // __OPENCL_C_VERSION__
+
+#define DEFINE_FOLLOW_CHAIN_FUNCTION(suffix, ptr_type, char_ptr_type, unit_ptr_type) \
+ptr_type port_memory_follow_chain##suffix( \
+        port_memory_ref_t ref, port_memory_ref_format_t format, \
+        ptr_type base_ptr, const PORT_KW_CONSTANT ptr_type *memory_table, \
+        size_t link_idx, size_t num_steps, ptr_type nodes[]) \
+{                                                                                               \
+    char_ptr_type node = port_memory_at##suffix(ref, format, base_ptr, memory_table);           \
+    if (nodes != NULL)                                                                          \
+        nodes[0] = node;                                                                        \
+                                                                                                \
+    for (size_t i = 1; i <= num_steps; i++)                                                     \
+    {                                                                                           \
+        ref = ((unit_ptr_type)node)[link_idx].PORT_MEMORY_UNIT__AS_REF;                        \
+        node = port_memory_at##suffix(ref, format, node, memory_table);                         \
+        if (nodes != NULL)                                                                      \
+            nodes[i] = node;                                                                    \
+    }                                                                                           \
+                                                                                                \
+    return node;                                                                                \
 }
 
+DEFINE_FOLLOW_CHAIN_FUNCTION(, port_const_void_ptr_t, port_const_char_ptr_t,
+        const port_memory_unit_t*)
+
+#ifdef __OPENCL_C_VERSION__
+
+DEFINE_FOLLOW_CHAIN_FUNCTION(_local, port_const_local_void_ptr_t, port_const_local_char_ptr_t,
+        const __local port_memory_unit_t*)
+DEFINE_FOLLOW_CHAIN_FUNCTION(_global, port_const_global_void_ptr_t, port_const_global_char_ptr_t,
+        const __global port_memory_unit_t*)
+DEFINE_FOLLOW_CHAIN_FUNCTION(_constant, port_constant_void_ptr_t, port_constant_char_ptr_t,
+        const __constant port_memory_unit_t*)
+
 #endif // __OPENCL_C_VERSION__
 
+#undef DEFINE_FOLLOW_CHAIN_FUNCTION
@@ -0,0 +1,145 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Unit arena allocation.
+ */
+
+#include "port/memory/arena.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.fun.h"
+
+#include <stdlib.h> // for realloc(), free()
+
+
+#define ROUND_UP(value, align) (((value) + (align) - 1) / (align) * (align))
+
+void
+port_memory_arena_init(
+        port_memory_arena_t *arena,
+        port_memory_ref_format_t format)
+{
+    if (arena == NULL)
+        return;
+
+    *arena = (port_memory_arena_t){.format = format};
+}
+
+void
+port_memory_arena_fini(
+        port_memory_arena_t *arena)
+{
+    if (arena == NULL)
+        return;
+
+    free(arena->segments);
+    *arena = (port_memory_arena_t){.format = arena->format};
+}
+
+bool
+port_memory_arena_add_segment(
+        port_memory_arena_t *arena,
+        port_void_ptr_t memory,
+        size_t num_bytes,
+        port_uint32_t tidx)
+{
+    if ((arena == NULL) || (memory == NULL))
+        return false;
+
+    if (arena->num_segments == arena->capacity)
+    {
+        port_uint32_t capacity = (arena->capacity > 0) ? 2 * arena->capacity : 4;
+
+        port_memory_arena_segment_t *segments = realloc(arena->segments, capacity * sizeof(*segments));
+        if (segments == NULL)
+            return false;
+
+        arena->segments = segments;
+        arena->capacity = capacity;
+    }
+
+    arena->segments[arena->num_segments++] = (port_memory_arena_segment_t){
+        .memory = memory, .num_units = num_bytes / sizeof(port_memory_unit_t), .tidx = tidx};
+
+    return true;
+}
+
+port_void_ptr_t
+port_memory_arena_alloc(
+        port_memory_arena_t *arena,
+        size_t num_units,
+        port_const_void_ptr_t base_ptr,
+
+        port_memory_ref_t *ref)
+{
+    if (arena == NULL)
+        return NULL;
+
+    size_t far_align = ((size_t)1 << arena->format.far.offset_lshift) / sizeof(port_memory_unit_t);
+    if (far_align == 0)
+        far_align = 1;
+
+    for (; arena->current < arena->num_segments; arena->current++)
+    {
+        port_memory_arena_segment_t *segment = &arena->segments[arena->current];
+
+        // Try near reference to the next free unit, base must be in the same segment
+        size_t offset = segment->num_used_units;
+        port_memory_unit_t *block = segment->memory + offset;
+
+        if ((base_ptr != NULL) && (num_units <= segment->num_units - offset) &&
+                ((const char*)segment->memory <= (const char*)base_ptr) &&
+                ((const char*)block > (const char*)base_ptr) &&
+                port_memory_ref_encode_near((const char*)block - (const char*)base_ptr, arena->format, ref))
+        {
+            segment->num_used_units = offset + num_units;
+            return block;
+        }
+
+        // Try far reference to the next suitably aligned unit
+        offset = ROUND_UP(segment->num_used_units, far_align);
+
+        if ((offset <= segment->num_units) && (num_units <= segment->num_units - offset) &&
+                port_memory_ref_encode_far(segment->tidx, offset * sizeof(port_memory_unit_t), arena->format, ref))
+        {
+            segment->num_used_units = offset + num_units;
+            return segment->memory + offset;
+        }
+    }
+
+    return NULL;
+}
+
+void
+port_memory_arena_reset(
+        port_memory_arena_t *arena)
+{
+    if (arena == NULL)
+        return;
+
+    for (port_uint32_t i = 0; i < arena->num_segments; i++)
+        arena->segments[i].num_used_units = 0;
+
+    arena->current = 0;
+}
+
+#endif // __OPENCL_C_VERSION__
@@ -0,0 +1,412 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Compression of cold memory segments.
+ */
+
+#include "port/memory/compress.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include <stdlib.h> // for malloc(), calloc(), realloc(), free()
+#include <string.h> // for memcpy()
+#include <stdint.h> // for SIZE_MAX
+
+
+#define GROUP_SIZE 32
+
+#define ZIGZAG(value) (((value) << 1) ^ (port_uint32_t)-((value) >> 31))
+#define UNZIGZAG(value) (((value) >> 1) ^ (port_uint32_t)-((value) & 1))
+
+///////////////////////////////////////////////////////////////////////////////
+// Block encoding
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Values are bit-packed in runs: the first record as is (as it contains whole references
+ * instead of differences), then every field of the rest of the records separately,
+ * so that a group contains values of the same field.
+ * Every run is split into groups of up to 32 values packed with the same width,
+ * and every group starts at a byte boundary.
+ */
+
+// Maximum size of an encoded block
+static size_t
+max_encoded_size(
+        size_t num_units,
+        size_t num_fields)
+{
+    size_t num_groups = num_units / GROUP_SIZE + num_fields + 2;
+    return num_groups + num_units * sizeof(port_uint32_t);
+}
+
+static size_t
+pack_run(
+        const port_uint32_t *values,
+        size_t step,
+        size_t num_values,
+        port_uint8_t *out)
+{
+    size_t pos = 0;
+
+    for (size_t g = 0; g < num_values; g += GROUP_SIZE)
+    {
+        size_t count = (num_values - g < GROUP_SIZE) ? num_values - g : GROUP_SIZE;
+
+        port_uint32_t all = 0;
+        for (size_t i = 0; i < count; i++)
+            all |= values[(g + i) * step];
+
+        unsigned width = (all != 0) ? 32 - __builtin_clz(all) : 0;
+        out[pos++] = width;
+
+        port_uint64_t acc = 0;
+        unsigned num_bits = 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            acc |= (port_uint64_t)values[(g + i) * step] << num_bits;
+            num_bits += width;
+
+            for (; num_bits >= 8; num_bits -= 8, acc >>= 8)
+                out[pos++] = acc;
+        }
+
+        if (num_bits > 0)
+            out[pos++] = acc;
+    }
+
+    return pos;
+}
+
+static bool
+unpack_run(
+        const port_uint8_t *in,
+        size_t in_size,
+        size_t *pos,
+        port_uint32_t *values,
+        size_t step,
+        size_t num_values)
+{
+    for (size_t g = 0; g < num_values; g += GROUP_SIZE)
+    {
+        size_t count = (num_values - g < GROUP_SIZE) ? num_values - g : GROUP_SIZE;
+
+        if (*pos >= in_size)
+            return false;
+
+        unsigned width = in[(*pos)++];
+        if ((width > 32) || (in_size - *pos < (width * count + 7) / 8))
+            return false;
+
+        port_uint32_t mask = (width < 32) ? ((port_uint32_t)1 << width) - 1 : ~(port_uint32_t)0;
+
+        port_uint64_t acc = 0;
+        unsigned num_bits = 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            for (; num_bits < width; num_bits += 8)
+                acc |= (port_uint64_t)in[(*pos)++] << num_bits;
+
+            values[(g + i) * step] = acc & mask;
+
+            acc >>= width;
+            num_bits -= width;
+        }
+    }
+
+    return true;
+}
+
+static size_t
+encode_block(
+        port_uint32_t *values, // is modified
+        size_t num_units,
+        port_memory_ref_map_t map,
+        port_uint8_t *out)
+{
+    size_t num_records = num_units / map.num_units;
+
+    // Replace references with differences from the previous record (going backwards)
+    for (size_t r = num_records; r-- > 1;)
+        for (port_uint32_t j = 0; j < map.num_refs; j++)
+        {
+            size_t idx = r * map.num_units + map.ref_units[j];
+            port_uint32_t delta = values[idx] - values[idx - map.num_units];
+            values[idx] = ZIGZAG(delta);
+        }
+
+    for (port_uint32_t j = 0; (num_records > 0) && (j < map.num_refs); j++)
+        values[map.ref_units[j]] = ZIGZAG(values[map.ref_units[j]]);
+
+    if (num_records == 0)
+        return 0;
+
+    size_t pos = pack_run(values, 1, map.num_units, out);
+
+    for (port_uint32_t f = 0; f < map.num_units; f++)
+        pos += pack_run(values + map.num_units + f, map.num_units, num_records - 1, out + pos);
+
+    return pos;
+}
+
+static bool
+decode_block(
+        const port_uint8_t *in,
+        size_t in_size,
+        size_t num_units,
+        port_memory_ref_map_t map,
+        port_uint32_t *values)
+{
+    size_t num_records = num_units / map.num_units;
+    if (num_records == 0)
+        return true;
+
+    size_t pos = 0;
+
+    if (!unpack_run(in, in_size, &pos, values, 1, map.num_units))
+        return false;
+
+    for (port_uint32_t f = 0; f < map.num_units; f++)
+        if (!unpack_run(in, in_size, &pos, values + map.num_units + f, map.num_units, num_records - 1))
+            return false;
+
+    // Restore references from differences (going forwards)
+    for (port_uint32_t j = 0; j < map.num_refs; j++)
+        values[map.ref_units[j]] = UNZIGZAG(values[map.ref_units[j]]);
+
+    for (size_t r = 1; r < num_records; r++)
+        for (port_uint32_t j = 0; j < map.num_refs; j++)
+        {
+            size_t idx = r * map.num_units + map.ref_units[j];
+            values[idx] = UNZIGZAG(values[idx]) + values[idx - map.num_units];
+        }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Compressed segments
+///////////////////////////////////////////////////////////////////////////////
+
+static size_t
+block_num_units(
+        const port_memory_compressed_segment_t *segment,
+        size_t block)
+{
+    size_t first = block * segment->block_units;
+    return (segment->num_units - first < segment->block_units) ? segment->num_units - first : segment->block_units;
+}
+
+port_memory_compressed_segment_t*
+port_memory_compress_segment(
+        port_const_void_ptr_t memory,
+        size_t num_bytes,
+        port_memory_ref_map_t map,
+        size_t block_units,
+        port_uint32_t cache_size)
+{
+    if ((memory == NULL) || (num_bytes % sizeof(port_memory_unit_t) != 0) ||
+            (block_units == 0) || (cache_size == 0))
+        return NULL;
+
+    if (map.num_units == 0)
+        map = (port_memory_ref_map_t){.num_units = 1};
+
+    for (port_uint32_t j = 0; j < map.num_refs; j++)
+        if (map.ref_units[j] >= map.num_units)
+            return NULL;
+
+    size_t num_units = num_bytes / sizeof(port_memory_unit_t);
+    if (num_units % map.num_units != 0)
+        return NULL;
+
+    block_units = (block_units + map.num_units - 1) / map.num_units * map.num_units;
+
+    port_memory_compressed_segment_t *segment = calloc(1, sizeof(*segment));
+    if (segment == NULL)
+        return NULL;
+
+    port_uint32_t *values = NULL;
+
+    segment->num_units = num_units;
+    segment->block_units = block_units;
+    segment->num_blocks = (num_units + block_units - 1) / block_units;
+
+    // Copy the map
+    segment->map = map;
+    if (map.num_refs > 0)
+    {
+        port_uint32_t *ref_units = malloc(map.num_refs * sizeof(*ref_units));
+        if (ref_units == NULL)
+            goto failure;
+
+        memcpy(ref_units, map.ref_units, map.num_refs * sizeof(*ref_units));
+        segment->map.ref_units = ref_units;
+    }
+    else
+        segment->map.ref_units = NULL;
+
+    // Allocate cache
+    segment->cache_size = cache_size;
+    segment->cache = calloc(cache_size, sizeof(*segment->cache));
+    if (segment->cache == NULL)
+        goto failure;
+
+    for (port_uint32_t i = 0; i < cache_size; i++)
+    {
+        segment->cache[i].block = SIZE_MAX;
+        segment->cache[i].units = malloc(block_units * sizeof(port_memory_unit_t));
+        if (segment->cache[i].units == NULL)
+            goto failure;
+    }
+
+    // Compress blocks
+    segment->block_offsets = malloc((segment->num_blocks + 1) * sizeof(*segment->block_offsets));
+    segment->data = malloc(segment->num_blocks * max_encoded_size(block_units, map.num_units));
+    values = malloc(block_units * sizeof(*values));
+    if ((segment->block_offsets == NULL) || (segment->data == NULL) || (values == NULL))
+        goto failure;
+
+    size_t pos = 0;
+    for (size_t block = 0; block < segment->num_blocks; block++)
+    {
+        size_t count = block_num_units(segment, block);
+        memcpy(values, (const port_memory_unit_t*)memory + block * block_units, count * sizeof(*values));
+
+        segment->block_offsets[block] = pos;
+        pos += encode_block(values, count, segment->map, segment->data + pos);
+    }
+    segment->block_offsets[segment->num_blocks] = pos;
+
+    free(values);
+
+    port_uint8_t *data = realloc(segment->data, (pos > 0) ? pos : 1);
+    if (data != NULL)
+        segment->data = data;
+
+    return segment;
+
+failure:
+    free(values);
+    port_memory_compressed_segment_destroy(segment);
+    return NULL;
+}
+
+void
+port_memory_compressed_segment_destroy(
+        port_memory_compressed_segment_t *segment)
+{
+    if (segment == NULL)
+        return;
+
+    if (segment->cache != NULL)
+        for (port_uint32_t i = 0; i < segment->cache_size; i++)
+            free(segment->cache[i].units);
+
+    free(segment->cache);
+    free((port_uint32_t*)segment->map.ref_units);
+    free(segment->block_offsets);
+    free(segment->data);
+    free(segment);
+}
+
+const port_memory_unit_t*
+port_memory_compressed_block(
+        port_memory_compressed_segment_t *segment,
+        size_t block)
+{
+    if ((segment == NULL) || (block >= segment->num_blocks))
+        return NULL;
+
+    segment->cache_time++;
+
+    // Look the block up, find the least recently used entry meanwhile
+    port_memory_compressed_cache_entry_t *lru = &segment->cache[0];
+
+    for (port_uint32_t i = 0; i < segment->cache_size; i++)
+    {
+        port_memory_compressed_cache_entry_t *entry = &segment->cache[i];
+
+        if (entry->block == block)
+        {
+            entry->last_use = segment->cache_time;
+            return entry->units;
+        }
+        else if (entry->last_use < lru->last_use)
+            lru = entry;
+    }
+
+    lru->block = SIZE_MAX;
+
+    size_t offset = segment->block_offsets[block];
+    if (!decode_block(segment->data + offset, segment->block_offsets[block + 1] - offset,
+                block_num_units(segment, block), segment->map, (port_uint32_t*)lru->units))
+        return NULL;
+
+    lru->block = block;
+    lru->last_use = segment->cache_time;
+
+    return lru->units;
+}
+
+const port_memory_unit_t*
+port_memory_compressed_at(
+        port_memory_compressed_segment_t *segment,
+        size_t offset)
+{
+    if (segment == NULL)
+        return NULL;
+
+    size_t unit = offset / sizeof(port_memory_unit_t);
+    if (unit >= segment->num_units)
+        return NULL;
+
+    const port_memory_unit_t *units = port_memory_compressed_block(segment, unit / segment->block_units);
+    if (units == NULL)
+        return NULL;
+
+    return units + unit % segment->block_units;
+}
+
+bool
+port_memory_compressed_materialize(
+        const port_memory_compressed_segment_t *segment,
+        port_void_ptr_t memory)
+{
+    if ((segment == NULL) || (memory == NULL))
+        return false;
+
+    for (size_t block = 0; block < segment->num_blocks; block++)
+    {
+        size_t offset = segment->block_offsets[block];
+
+        if (!decode_block(segment->data + offset, segment->block_offsets[block + 1] - offset,
+                    block_num_units(segment, block), segment->map,
+                    (port_uint32_t*)memory + block * segment->block_units))
+            return false;
+    }
+
+    return true;
+}
+
+#endif // __OPENCL_C_VERSION__
@@ -24,170 +24,85 @@
 
 #include "port/memory/copy.fun.h"
 
-#ifndef __OPENCL_C_VERSION__
-#  include <string.h> // for memcpy()
-#  include <assert.h>
+#ifndef PORT_FEATURE_INLINE
+#  include "port/memory/copy.inl.h"
 #endif
 
 
-///////////////////////////////////////////////////////////////////////////////
-// Generic memory
-///////////////////////////////////////////////////////////////////////////////
-
-void
-port_memory_copy(
-        port_void_ptr_t restrict dest,
-        port_const_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-#ifdef __OPENCL_C_VERSION__
-    for (size_t i = 0; i < num_bytes; i++)
-        ((char*)dest)[i] = ((const char*)src)[i];
-#else
-    assert(dest != NULL);
-    assert(src != NULL);
-
-    memcpy(dest, src, num_bytes);
-#endif
-}
-
-#ifdef __OPENCL_C_VERSION__
+#include "port/memory.fun.h"
+#include "port/memory.def.h"
 
 ///////////////////////////////////////////////////////////////////////////////
-// Private source
+// Copying with remapping of memory references
 ///////////////////////////////////////////////////////////////////////////////
 
-void
-port_memory_copy_private_to_private(
-        port_private_void_ptr_t restrict dest,
-        port_const_private_void_ptr_t restrict src,
-        size_t num_bytes)
+static bool
+remap_ref(
+        port_memory_ref_t *ref,
+        size_t node_pos, // position of the node containing the reference relative to the block
+        size_t block_size,
+        port_memory_ref_format_t format,
+        port_memory_ref_remap_t remap)
 {
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__private char*)dest)[i] = ((const __private char*)src)[i];
+    port_uint32_t tidx;
+    size_t offset;
+
+    if (PORT_MEMORY_REF_IS_FAR(*ref))
+    {
+        tidx = PORT_MEMORY_REF_FAR__TABLE_INDEX(*ref, format.far.num_tidx_bits);
+        offset = (size_t)PORT_MEMORY_REF_FAR__OFFSET(*ref, format.far.num_tidx_bits) << format.far.offset_lshift;
+
+        if ((tidx == remap.src_tidx) && (offset >= remap.src_offset) && (offset - remap.src_offset < block_size))
+            return port_memory_ref_encode_far(remap.dest_tidx,
+                    offset - remap.src_offset + remap.dest_offset, format, ref);
+    }
+    else
+    {
+        // Position of the target relative to the source block
+        size_t pos = node_pos + (((size_t)(-(*ref + 1)) + 1) << format.near.offset_lshift);
+
+        // Target is copied too, and its position relative to the node is kept
+        if (pos < block_size)
+            return true;
+
+        tidx = remap.src_tidx;
+        offset = remap.src_offset + pos;
+    }
+
+    if (remap.tidx_map != NULL)
+        tidx = remap.tidx_map[tidx];
+
+    return port_memory_ref_encode_far(tidx, offset, format, ref);
 }
 
-void
-port_memory_copy_private_to_local(
-        port_local_void_ptr_t restrict dest,
-        port_const_private_void_ptr_t restrict src,
-        size_t num_bytes)
+bool
+port_memory_copy_remap(
+        port_memory_unit_t *restrict dest,
+        const port_memory_unit_t *restrict src,
+        size_t num_nodes,
+        port_memory_ref_map_t map,
+        port_memory_ref_format_t format,
+        port_memory_ref_remap_t remap)
 {
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__local char*)dest)[i] = ((const __private char*)src)[i];
-}
+    size_t node_size = map.num_units * sizeof(port_memory_unit_t);
+    size_t block_size = num_nodes * node_size;
 
-void
-port_memory_copy_private_to_global(
-        port_global_void_ptr_t restrict dest,
-        port_const_private_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__global char*)dest)[i] = ((const __private char*)src)[i];
-}
+    for (size_t n = 0; n < num_nodes; n++)
+    {
+        port_memory_unit_t *dest_node = dest + n * map.num_units;
+        const port_memory_unit_t *src_node = src + n * map.num_units;
 
-///////////////////////////////////////////////////////////////////////////////
-// Local source
-///////////////////////////////////////////////////////////////////////////////
+        for (port_uint32_t i = 0; i < map.num_units; i++)
+            dest_node[i] = src_node[i];
 
-void
-port_memory_copy_local_to_private(
-        port_private_void_ptr_t restrict dest,
-        port_const_local_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__private char*)dest)[i] = ((const __local char*)src)[i];
-}
+        for (port_uint32_t j = 0; j < map.num_refs; j++)
+        {
+            port_memory_ref_t *ref = &dest_node[map.ref_units[j]].PORT_MEMORY_UNIT__AS_REF;
 
-void
-port_memory_copy_local_to_local(
-        port_local_void_ptr_t restrict dest,
-        port_const_local_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__local char*)dest)[i] = ((const __local char*)src)[i];
-}
+            if (!remap_ref(ref, n * node_size, block_size, format, remap))
+                return false;
+        }
+    }
 
-void
-port_memory_copy_local_to_global(
-        port_global_void_ptr_t restrict dest,
-        port_const_local_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__global char*)dest)[i] = ((const __local char*)src)[i];
+    return true;
 }
-
-///////////////////////////////////////////////////////////////////////////////
-// Global source
-///////////////////////////////////////////////////////////////////////////////
-
-void
-port_memory_copy_global_to_private(
-        port_private_void_ptr_t restrict dest,
-        port_const_global_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__private char*)dest)[i] = ((const __global char*)src)[i];
-}
-
-void
-port_memory_copy_global_to_local(
-        port_local_void_ptr_t restrict dest,
-        port_const_global_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__local char*)dest)[i] = ((const __global char*)src)[i];
-}
-
-void
-port_memory_copy_global_to_global(
-        port_global_void_ptr_t restrict dest,
-        port_const_global_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__global char*)dest)[i] = ((const __global char*)src)[i];
-}
-
-///////////////////////////////////////////////////////////////////////////////
-// Constant source
-///////////////////////////////////////////////////////////////////////////////
-
-void
-port_memory_copy_constant_to_private(
-        port_private_void_ptr_t restrict dest,
-        port_constant_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__private char*)dest)[i] = ((const __constant char*)src)[i];
-}
-
-void
-port_memory_copy_constant_to_local(
-        port_local_void_ptr_t restrict dest,
-        port_constant_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__local char*)dest)[i] = ((const __constant char*)src)[i];
-}
-
-void
-port_memory_copy_constant_to_global(
-        port_global_void_ptr_t restrict dest,
-        port_constant_void_ptr_t restrict src,
-        size_t num_bytes)
-{
-    for (size_t i = 0; i < num_bytes; i++)
-        ((__global char*)dest)[i] = ((const __constant char*)src)[i];
-}
-
-#endif // __OPENCL_C_VERSION__
-
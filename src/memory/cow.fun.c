@@ -0,0 +1,410 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Copy-on-write versioned segments.
+ */
+
+#define _GNU_SOURCE // for memfd_create(), fallocate(), FALLOC_FL_PUNCH_HOLE
+
+#include "port/memory/cow.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include <stdbool.h>
+#include <stdlib.h> // for calloc(), realloc(), free()
+#include <string.h> // for memset()
+#include <fcntl.h> // for fallocate()
+#include <sys/mman.h> // for memfd_create(), mmap(), munmap(), mprotect()
+#include <unistd.h> // for ftruncate(), pwrite(), sysconf(), close()
+
+///////////////////////////////////////////////////////////////////////////////
+// File blocks
+///////////////////////////////////////////////////////////////////////////////
+
+static bool
+reserve_file_blocks(
+        port_memory_cow_t *cow,
+        size_t num_blocks)
+{
+    if (cow->num_file_blocks + num_blocks <= cow->file_capacity)
+        return true;
+
+    size_t capacity = 2 * cow->file_capacity;
+    if (capacity < cow->num_file_blocks + num_blocks)
+        capacity = cow->num_file_blocks + num_blocks;
+
+    port_uint32_t *refcounts = realloc(cow->refcounts, capacity * sizeof(*refcounts));
+    if (refcounts == NULL)
+        return false;
+    cow->refcounts = refcounts;
+
+    size_t *free_blocks = realloc(cow->free_blocks, capacity * sizeof(*free_blocks));
+    if (free_blocks == NULL)
+        return false;
+    cow->free_blocks = free_blocks;
+
+    if (ftruncate(cow->fd, (off_t)(capacity * cow->block_size)) != 0)
+        return false;
+
+    cow->file_capacity = capacity;
+    return true;
+}
+
+// Never used blocks at the end of file are zero
+static bool
+alloc_new_file_blocks(
+        port_memory_cow_t *cow,
+        size_t num_blocks,
+        size_t *first)
+{
+    if (!reserve_file_blocks(cow, num_blocks))
+        return false;
+
+    *first = cow->num_file_blocks;
+    for (size_t i = 0; i < num_blocks; i++)
+        cow->refcounts[*first + i] = 1;
+
+    cow->num_file_blocks += num_blocks;
+    return true;
+}
+
+static bool
+alloc_file_block(
+        port_memory_cow_t *cow,
+        size_t *block)
+{
+    if (cow->num_free_blocks > 0)
+    {
+        *block = cow->free_blocks[--cow->num_free_blocks];
+        cow->refcounts[*block] = 1;
+        return true;
+    }
+
+    return alloc_new_file_blocks(cow, 1, block);
+}
+
+static void
+release_file_block(
+        port_memory_cow_t *cow,
+        size_t block)
+{
+    if (--cow->refcounts[block] > 0)
+        return;
+
+    // Return memory of the block to the system
+    fallocate(cow->fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+            (off_t)(block * cow->block_size), (off_t)cow->block_size);
+
+    cow->free_blocks[cow->num_free_blocks++] = block;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Store
+///////////////////////////////////////////////////////////////////////////////
+
+port_memory_cow_t*
+port_memory_cow_create(
+        port_uint32_t num_segments,
+        const size_t segment_sizes[],
+        size_t block_size)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    if ((num_segments == 0) || (segment_sizes == NULL) ||
+            (block_size == 0) || (page_size <= 0) || (block_size % (size_t)page_size != 0))
+        return NULL;
+
+    port_memory_cow_t *cow = calloc(1, sizeof(*cow));
+    if (cow == NULL)
+        return NULL;
+
+    cow->fd = -1;
+    cow->block_size = block_size;
+    cow->num_segments = num_segments;
+
+    cow->segment_sizes = calloc(num_segments, sizeof(*cow->segment_sizes));
+    cow->segment_num_blocks = calloc(num_segments, sizeof(*cow->segment_num_blocks));
+    if ((cow->segment_sizes == NULL) || (cow->segment_num_blocks == NULL))
+        goto failure;
+
+    for (port_uint32_t tidx = 0; tidx < num_segments; tidx++)
+    {
+        if (segment_sizes[tidx] == 0)
+            goto failure;
+
+        cow->segment_sizes[tidx] = segment_sizes[tidx];
+        cow->segment_num_blocks[tidx] = (segment_sizes[tidx] + block_size - 1) / block_size;
+    }
+
+    cow->fd = memfd_create("port_memory_cow", MFD_CLOEXEC);
+    if (cow->fd < 0)
+        goto failure;
+
+    return cow;
+
+failure:
+    port_memory_cow_destroy(cow);
+    return NULL;
+}
+
+void
+port_memory_cow_destroy(
+        port_memory_cow_t *cow)
+{
+    if (cow == NULL)
+        return;
+
+    if (cow->fd >= 0)
+        close(cow->fd);
+
+    free(cow->segment_sizes);
+    free(cow->segment_num_blocks);
+    free(cow->refcounts);
+    free(cow->free_blocks);
+    free(cow);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Versions
+///////////////////////////////////////////////////////////////////////////////
+
+// Map segment blocks, coalescing runs of consecutive file blocks into single mappings
+static bool
+map_segment(
+        port_memory_cow_version_t *version,
+        port_uint32_t tidx,
+        int prot)
+{
+    port_memory_cow_t *cow = version->cow;
+    size_t num_blocks = cow->segment_num_blocks[tidx];
+    const size_t *blocks = version->blocks[tidx];
+
+    char *memory = mmap(NULL, num_blocks * cow->block_size, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (memory == MAP_FAILED)
+        return false;
+
+    version->pointers[tidx] = memory;
+
+    for (size_t i = 0, run; i < num_blocks; i += run)
+    {
+        for (run = 1; (i + run < num_blocks) && (blocks[i + run] == blocks[i] + run); run++);
+
+        if (mmap(memory + i * cow->block_size, run * cow->block_size, prot, MAP_SHARED | MAP_FIXED,
+                    cow->fd, (off_t)(blocks[i] * cow->block_size)) == MAP_FAILED)
+            return false;
+    }
+
+    return true;
+}
+
+port_memory_cow_version_t*
+port_memory_cow_version_create(
+        port_memory_cow_t *cow,
+        port_memory_cow_version_t *base)
+{
+    if ((cow == NULL) || ((base != NULL) && (base->cow != cow)))
+        return NULL;
+
+    port_memory_cow_version_t *version = calloc(1, sizeof(*version));
+    if (version == NULL)
+        return NULL;
+
+    version->cow = cow;
+
+    version->pointers = calloc(cow->num_segments, sizeof(*version->pointers));
+    version->blocks = calloc(cow->num_segments, sizeof(*version->blocks));
+    version->writable = calloc(cow->num_segments, sizeof(*version->writable));
+    if ((version->pointers == NULL) || (version->blocks == NULL) || (version->writable == NULL))
+        goto failure;
+
+    for (port_uint32_t tidx = 0; tidx < cow->num_segments; tidx++)
+    {
+        size_t num_blocks = cow->segment_num_blocks[tidx];
+
+        version->writable[tidx] = malloc(num_blocks);
+        if (version->writable[tidx] == NULL)
+            goto failure;
+
+        size_t *blocks = malloc(num_blocks * sizeof(*blocks));
+        if (blocks == NULL)
+            goto failure;
+
+        if (base == NULL)
+        {
+            size_t first;
+            if (!alloc_new_file_blocks(cow, num_blocks, &first))
+            {
+                free(blocks);
+                goto failure;
+            }
+
+            for (size_t i = 0; i < num_blocks; i++)
+                blocks[i] = first + i;
+
+            memset(version->writable[tidx], 1, num_blocks);
+        }
+        else
+        {
+            for (size_t i = 0; i < num_blocks; i++)
+            {
+                blocks[i] = base->blocks[tidx][i];
+                cow->refcounts[blocks[i]]++;
+            }
+
+            memset(version->writable[tidx], 0, num_blocks);
+        }
+
+        // From now on, the version holds references to the blocks
+        version->blocks[tidx] = blocks;
+
+        if (!map_segment(version, tidx, (base == NULL) ? PROT_READ | PROT_WRITE : PROT_READ))
+            goto failure;
+    }
+
+    // Base version shares all of its blocks now
+    if (base != NULL)
+    {
+        for (port_uint32_t tidx = 0; tidx < cow->num_segments; tidx++)
+        {
+            size_t num_blocks = cow->segment_num_blocks[tidx];
+
+            mprotect((port_void_ptr_t)base->pointers[tidx], num_blocks * cow->block_size, PROT_READ);
+            memset(base->writable[tidx], 0, num_blocks);
+        }
+    }
+
+    return version;
+
+failure:
+    port_memory_cow_version_destroy(version);
+    return NULL;
+}
+
+void
+port_memory_cow_version_destroy(
+        port_memory_cow_version_t *version)
+{
+    if (version == NULL)
+        return;
+
+    port_memory_cow_t *cow = version->cow;
+
+    for (port_uint32_t tidx = 0; tidx < cow->num_segments; tidx++)
+    {
+        size_t num_blocks = cow->segment_num_blocks[tidx];
+
+        if ((version->pointers != NULL) && (version->pointers[tidx] != NULL))
+            munmap((port_void_ptr_t)version->pointers[tidx], num_blocks * cow->block_size);
+
+        if ((version->blocks != NULL) && (version->blocks[tidx] != NULL))
+        {
+            for (size_t i = 0; i < num_blocks; i++)
+                release_file_block(cow, version->blocks[tidx][i]);
+
+            free(version->blocks[tidx]);
+        }
+
+        if (version->writable != NULL)
+            free(version->writable[tidx]);
+    }
+
+    free(version->pointers);
+    free(version->blocks);
+    free(version->writable);
+    free(version);
+}
+
+port_void_ptr_t
+port_memory_cow_write(
+        port_memory_cow_version_t *version,
+        port_uint32_t tidx,
+        size_t offset,
+        size_t num_bytes)
+{
+    if ((version == NULL) || (tidx >= version->cow->num_segments))
+        return NULL;
+
+    port_memory_cow_t *cow = version->cow;
+    char *memory = (char*)version->pointers[tidx];
+
+    if ((offset > cow->segment_sizes[tidx]) || (num_bytes > cow->segment_sizes[tidx] - offset))
+        return NULL;
+    else if (num_bytes == 0)
+        return memory + offset;
+
+    size_t first = offset / cow->block_size;
+    size_t last = (offset + num_bytes - 1) / cow->block_size;
+
+    port_uint8_t *writable = version->writable[tidx];
+    size_t *blocks = version->blocks[tidx];
+
+    // Runs of adjacent blocks are remapped at once to limit the number of mappings
+    for (size_t i = first, run; i <= last; i += run)
+    {
+        run = 1;
+        if (writable[i])
+            continue;
+
+        bool shared = cow->refcounts[blocks[i]] > 1;
+        while ((i + run <= last) && !writable[i + run] && ((cow->refcounts[blocks[i + run]] > 1) == shared))
+            run++;
+
+        char *run_memory = memory + i * cow->block_size;
+        size_t run_size = run * cow->block_size;
+
+        if (!shared)
+        {
+            // Blocks are not shared anymore, no need to copy
+            if (mprotect(run_memory, run_size, PROT_READ | PROT_WRITE) != 0)
+                return NULL;
+        }
+        else
+        {
+            // Copies of the run are consecutive in the file, so they are mapped with a single mapping
+            size_t new_first;
+            if (!((run == 1) ? alloc_file_block(cow, &new_first) : alloc_new_file_blocks(cow, run, &new_first)))
+                return NULL;
+
+            if ((pwrite(cow->fd, run_memory, run_size,
+                            (off_t)(new_first * cow->block_size)) != (ssize_t)run_size) ||
+                    (mmap(run_memory, run_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                          cow->fd, (off_t)(new_first * cow->block_size)) == MAP_FAILED))
+            {
+                for (size_t k = 0; k < run; k++)
+                    release_file_block(cow, new_first + k);
+                return NULL;
+            }
+
+            for (size_t k = 0; k < run; k++)
+            {
+                release_file_block(cow, blocks[i + k]);
+                blocks[i + k] = new_first + k;
+            }
+        }
+
+        memset(writable + i, 1, run);
+    }
+
+    return memory + offset;
+}
+
+#endif // __OPENCL_C_VERSION__
@@ -0,0 +1,229 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Dirty range tracking for incremental segment transfers.
+ */
+
+#include "port/memory/dirty.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include <stdlib.h> // for calloc(), free()
+#include <stdint.h> // for uintptr_t
+
+
+#define WORD_BITS 64
+
+// Mask of bits lo..hi (inclusive) of a bitmap word
+#define RANGE_MASK(lo, hi) ((~(port_uint64_t)0 << (lo)) & (~(port_uint64_t)0 >> (WORD_BITS - 1 - (hi))))
+
+port_memory_dirty_t*
+port_memory_dirty_create(
+        const port_memory_table_t *table,
+        port_uint8_t block_size_log2)
+{
+    if ((table == NULL) || (block_size_log2 >= 48))
+        return NULL;
+
+    port_memory_dirty_t *dirty = calloc(1, sizeof(*dirty));
+    if (dirty == NULL)
+        return NULL;
+
+    dirty->block_size_log2 = block_size_log2;
+    dirty->num_segments = table->num_segments;
+
+    if (table->num_segments > 0)
+    {
+        dirty->segments = calloc(table->num_segments, sizeof(*dirty->segments));
+        if (dirty->segments == NULL)
+            goto failure;
+    }
+
+    for (port_uint32_t tidx = 0; tidx < table->num_segments; tidx++)
+    {
+        port_memory_dirty_segment_t *segment = &dirty->segments[tidx];
+
+        segment->memory = table->segments[tidx].memory;
+        segment->num_bytes = table->segments[tidx].num_bytes;
+
+        size_t num_blocks = (segment->num_bytes + ((size_t)1 << block_size_log2) - 1) >> block_size_log2;
+        segment->num_words = (num_blocks + WORD_BITS - 1) / WORD_BITS;
+
+        if (segment->num_words > 0)
+        {
+            segment->bits = calloc(segment->num_words, sizeof(*segment->bits));
+            if (segment->bits == NULL)
+                goto failure;
+        }
+    }
+
+    return dirty;
+
+failure:
+    port_memory_dirty_destroy(dirty);
+    return NULL;
+}
+
+void
+port_memory_dirty_destroy(
+        port_memory_dirty_t *dirty)
+{
+    if (dirty == NULL)
+        return;
+
+    if (dirty->segments != NULL)
+    {
+        for (port_uint32_t tidx = 0; tidx < dirty->num_segments; tidx++)
+            free(dirty->segments[tidx].bits);
+
+        free(dirty->segments);
+    }
+
+    free(dirty);
+}
+
+void
+port_memory_dirty_mark(
+        port_memory_dirty_t *dirty,
+        port_uint32_t tidx,
+        size_t offset,
+        size_t num_bytes)
+{
+    if ((dirty == NULL) || (tidx >= dirty->num_segments) || (num_bytes == 0))
+        return;
+
+    port_memory_dirty_segment_t *segment = &dirty->segments[tidx];
+    if (offset >= segment->num_bytes)
+        return;
+
+    if (num_bytes > segment->num_bytes - offset)
+        num_bytes = segment->num_bytes - offset;
+
+    size_t first = offset >> dirty->block_size_log2;
+    size_t last = (offset + num_bytes - 1) >> dirty->block_size_log2;
+
+    for (size_t w = first / WORD_BITS; w <= last / WORD_BITS; w++)
+    {
+        unsigned lo = (w == first / WORD_BITS) ? first % WORD_BITS : 0;
+        unsigned hi = (w == last / WORD_BITS) ? last % WORD_BITS : WORD_BITS - 1;
+
+        atomic_fetch_or_explicit(&segment->bits[w], RANGE_MASK(lo, hi), memory_order_release);
+    }
+}
+
+bool
+port_memory_dirty_mark_ptr(
+        port_memory_dirty_t *dirty,
+        port_const_void_ptr_t memory,
+        size_t num_bytes)
+{
+    if ((dirty == NULL) || (memory == NULL))
+        return false;
+
+    for (port_uint32_t tidx = 0; tidx < dirty->num_segments; tidx++)
+    {
+        const port_memory_dirty_segment_t *segment = &dirty->segments[tidx];
+        if (segment->memory == NULL)
+            continue;
+
+        uintptr_t start = (uintptr_t)segment->memory;
+        if (((uintptr_t)memory >= start) && ((uintptr_t)memory - start < segment->num_bytes))
+        {
+            port_memory_dirty_mark(dirty, tidx, (uintptr_t)memory - start, num_bytes);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool
+port_memory_dirty_next_range(
+        port_memory_dirty_t *dirty,
+        port_uint32_t tidx,
+        size_t *offset,
+        size_t *num_bytes,
+        bool clear)
+{
+    if ((dirty == NULL) || (tidx >= dirty->num_segments) || (offset == NULL))
+        return false;
+
+    port_memory_dirty_segment_t *segment = &dirty->segments[tidx];
+    if (*offset >= segment->num_bytes)
+        return false;
+
+    // Find the first dirty block
+    size_t block = *offset >> dirty->block_size_log2;
+    size_t w = block / WORD_BITS;
+
+    port_uint64_t word = atomic_load_explicit(&segment->bits[w], memory_order_acquire) &
+        RANGE_MASK(block % WORD_BITS, WORD_BITS - 1);
+
+    while (word == 0)
+    {
+        if (++w == segment->num_words)
+            return false;
+
+        word = atomic_load_explicit(&segment->bits[w], memory_order_acquire);
+    }
+
+    size_t first = w * WORD_BITS + __builtin_ctzll(word);
+
+    // Find the first clean block after it
+    word = ~atomic_load_explicit(&segment->bits[w], memory_order_acquire) &
+        RANGE_MASK(first % WORD_BITS, WORD_BITS - 1);
+
+    while (word == 0)
+    {
+        if (++w == segment->num_words)
+            break;
+
+        word = ~atomic_load_explicit(&segment->bits[w], memory_order_acquire);
+    }
+
+    size_t end = (word != 0) ? w * WORD_BITS + __builtin_ctzll(word) : segment->num_words * WORD_BITS;
+
+    if (clear)
+    {
+        size_t last = end - 1;
+
+        for (w = first / WORD_BITS; w <= last / WORD_BITS; w++)
+        {
+            unsigned lo = (w == first / WORD_BITS) ? first % WORD_BITS : 0;
+            unsigned hi = (w == last / WORD_BITS) ? last % WORD_BITS : WORD_BITS - 1;
+
+            atomic_fetch_and_explicit(&segment->bits[w], ~RANGE_MASK(lo, hi), memory_order_acq_rel);
+        }
+    }
+
+    *offset = first << dirty->block_size_log2;
+
+    size_t range_end = end << dirty->block_size_log2;
+    if (range_end > segment->num_bytes)
+        range_end = segment->num_bytes;
+
+    if (num_bytes != NULL)
+        *num_bytes = range_end - *offset;
+
+    return true;
+}
+
+#endif // __OPENCL_C_VERSION__
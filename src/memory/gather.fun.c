@@ -0,0 +1,376 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Strided, gather and scatter access to arrays of built-in types.
+ */
+
+#include "port/memory/gather.fun.h"
+
+#if !defined(__OPENCL_C_VERSION__) && defined(__x86_64__) && (defined(__AVX2__) || defined(__AVX512F__))
+#  define SIMD_GATHER
+#  include <immintrin.h>
+#  include <stdint.h> // for uintptr_t, INT32_MIN, INT32_MAX
+#  include <stdbool.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// SIMD helpers
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Helpers process the longest prefix of whole vectors and return its length,
+ * the rest of the elements is processed by the scalar loop.
+ */
+
+#define SIMD_NONE(op, ...) 0
+
+#ifdef SIMD_GATHER
+
+#  define SIMD_32(op, ...) op##_32bit(__VA_ARGS__)
+#  define SIMD_64(op, ...) op##_64bit(__VA_ARGS__)
+
+/*
+ * Gather and scatter instructions sign-extend 32-bit indices,
+ * so unsigned indices are biased by -2^31 and the base address
+ * is moved forward by 2^31 elements to compensate.
+ */
+static const void*
+biased_base(
+        const void *memory,
+        size_t scale)
+{
+    return (const void*)((uintptr_t)memory + ((uintptr_t)1 << 31) * scale);
+}
+
+/*
+ * Strided access is done with gathers/scatters if all element indices
+ * fit into 32-bit signed integers without bias.
+ * Unit stride is left for the scalar loop, which the compiler vectorizes.
+ */
+static bool
+stride_fits(
+        size_t stride,
+        size_t count)
+{
+    return (stride > 1) && (count > 0) && (stride <= (size_t)INT32_MAX / count);
+}
+
+static size_t
+gather_32bit(
+        const void *memory,
+        const port_uint32_t *indices,
+        size_t count,
+        void *out)
+{
+    size_t i = 0;
+    const void *base = biased_base(memory, 4);
+
+#  ifdef __AVX512F__
+    const __m512i bias = _mm512_set1_epi32(INT32_MIN);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512i idx = _mm512_xor_si512(_mm512_loadu_si512(indices + i), bias);
+        _mm512_storeu_si512((port_uint32_t*)out + i, _mm512_i32gather_epi32(idx, base, 4));
+    }
+#  else
+    const __m256i bias = _mm256_set1_epi32(INT32_MIN);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i idx = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(indices + i)), bias);
+        _mm256_storeu_si256((__m256i*)((port_uint32_t*)out + i), _mm256_i32gather_epi32(base, idx, 4));
+    }
+#  endif
+
+    return i;
+}
+
+static size_t
+gather_64bit(
+        const void *memory,
+        const port_uint32_t *indices,
+        size_t count,
+        void *out)
+{
+    size_t i = 0;
+    const void *base = biased_base(memory, 8);
+
+#  ifdef __AVX512F__
+    const __m256i bias = _mm256_set1_epi32(INT32_MIN);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i idx = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(indices + i)), bias);
+        _mm512_storeu_si512((port_uint64_t*)out + i, _mm512_i32gather_epi64(idx, base, 8));
+    }
+#  else
+    const __m128i bias = _mm_set1_epi32(INT32_MIN);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i idx = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(indices + i)), bias);
+        _mm256_storeu_si256((__m256i*)((port_uint64_t*)out + i), _mm256_i32gather_epi64(base, idx, 8));
+    }
+#  endif
+
+    return i;
+}
+
+static size_t
+read_strided_32bit(
+        const void *memory,
+        size_t stride,
+        size_t count,
+        void *out)
+{
+    size_t i = 0;
+    if (!stride_fits(stride, count))
+        return i;
+
+#  ifdef __AVX512F__
+    __m512i idx = _mm512_mullo_epi32(_mm512_setr_epi32(
+                0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((int)stride));
+    const __m512i step = _mm512_set1_epi32((int)(16 * stride));
+    for (; i + 16 <= count; i += 16, idx = _mm512_add_epi32(idx, step))
+        _mm512_storeu_si512((port_uint32_t*)out + i, _mm512_i32gather_epi32(idx, memory, 4));
+#  else
+    __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)stride));
+    const __m256i step = _mm256_set1_epi32((int)(8 * stride));
+    for (; i + 8 <= count; i += 8, idx = _mm256_add_epi32(idx, step))
+        _mm256_storeu_si256((__m256i*)((port_uint32_t*)out + i), _mm256_i32gather_epi32(memory, idx, 4));
+#  endif
+
+    return i;
+}
+
+static size_t
+read_strided_64bit(
+        const void *memory,
+        size_t stride,
+        size_t count,
+        void *out)
+{
+    size_t i = 0;
+    if (!stride_fits(stride, count))
+        return i;
+
+#  ifdef __AVX512F__
+    __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)stride));
+    const __m256i step = _mm256_set1_epi32((int)(8 * stride));
+    for (; i + 8 <= count; i += 8, idx = _mm256_add_epi32(idx, step))
+        _mm512_storeu_si512((port_uint64_t*)out + i, _mm512_i32gather_epi64(idx, memory, 8));
+#  else
+    __m128i idx = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32((int)stride));
+    const __m128i step = _mm_set1_epi32((int)(4 * stride));
+    for (; i + 4 <= count; i += 4, idx = _mm_add_epi32(idx, step))
+        _mm256_storeu_si256((__m256i*)((port_uint64_t*)out + i), _mm256_i32gather_epi64(memory, idx, 8));
+#  endif
+
+    return i;
+}
+
+// AVX2 has no scatter instructions
+static size_t
+scatter_32bit(
+        void *memory,
+        const port_uint32_t *indices,
+        size_t count,
+        const void *in)
+{
+    size_t i = 0;
+
+#  ifdef __AVX512F__
+    void *base = (void*)biased_base(memory, 4);
+    const __m512i bias = _mm512_set1_epi32(INT32_MIN);
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512i idx = _mm512_xor_si512(_mm512_loadu_si512(indices + i), bias);
+        _mm512_i32scatter_epi32(base, idx, _mm512_loadu_si512((const port_uint32_t*)in + i), 4);
+    }
+#  else
+    (void) memory;
+    (void) indices;
+    (void) count;
+    (void) in;
+#  endif
+
+    return i;
+}
+
+static size_t
+scatter_64bit(
+        void *memory,
+        const port_uint32_t *indices,
+        size_t count,
+        const void *in)
+{
+    size_t i = 0;
+
+#  ifdef __AVX512F__
+    void *base = (void*)biased_base(memory, 8);
+    const __m256i bias = _mm256_set1_epi32(INT32_MIN);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i idx = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(indices + i)), bias);
+        _mm512_i32scatter_epi64(base, idx, _mm512_loadu_si512((const port_uint64_t*)in + i), 8);
+    }
+#  else
+    (void) memory;
+    (void) indices;
+    (void) count;
+    (void) in;
+#  endif
+
+    return i;
+}
+
+static size_t
+write_strided_32bit(
+        void *memory,
+        size_t stride,
+        size_t count,
+        const void *in)
+{
+    size_t i = 0;
+
+#  ifdef __AVX512F__
+    if (!stride_fits(stride, count))
+        return i;
+
+    __m512i idx = _mm512_mullo_epi32(_mm512_setr_epi32(
+                0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32((int)stride));
+    const __m512i step = _mm512_set1_epi32((int)(16 * stride));
+    for (; i + 16 <= count; i += 16, idx = _mm512_add_epi32(idx, step))
+        _mm512_i32scatter_epi32(memory, idx, _mm512_loadu_si512((const port_uint32_t*)in + i), 4);
+#  else
+    (void) memory;
+    (void) stride;
+    (void) count;
+    (void) in;
+#  endif
+
+    return i;
+}
+
+static size_t
+write_strided_64bit(
+        void *memory,
+        size_t stride,
+        size_t count,
+        const void *in)
+{
+    size_t i = 0;
+
+#  ifdef __AVX512F__
+    if (!stride_fits(stride, count))
+        return i;
+
+    __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)stride));
+    const __m256i step = _mm256_set1_epi32((int)(8 * stride));
+    for (; i + 8 <= count; i += 8, idx = _mm256_add_epi32(idx, step))
+        _mm512_i32scatter_epi64(memory, idx, _mm512_loadu_si512((const port_uint64_t*)in + i), 8);
+#  else
+    (void) memory;
+    (void) stride;
+    (void) count;
+    (void) in;
+#  endif
+
+    return i;
+}
+
+#else // SIMD_GATHER
+
+#  define SIMD_32 SIMD_NONE
+#  define SIMD_64 SIMD_NONE
+
+#endif // SIMD_GATHER
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for built-in types
+///////////////////////////////////////////////////////////////////////////////
+
+#define DEFINE_READ_FUNCTIONS(type, simd, name_as, ptr_type, as) \
+void port_memory_read##name_as##_##type##_strided(ptr_type memory,                  \
+        size_t offset, size_t stride, size_t count, port_##type##_t *out)           \
+{                                                                                   \
+    const as port_##type##_t *elements = (const as port_##type##_t*)memory + offset; \
+    for (size_t i = simd(read_strided, elements, stride, count, out); i < count; i++) \
+        out[i] = elements[i * stride];                                              \
+}                                                                                   \
+                                                                                    \
+void port_memory_gather##name_as##_##type(ptr_type memory,                          \
+        const port_uint32_t *indices, size_t count, port_##type##_t *out)           \
+{                                                                                   \
+    const as port_##type##_t *elements = (const as port_##type##_t*)memory;         \
+    for (size_t i = simd(gather, elements, indices, count, out); i < count; i++)    \
+        out[i] = elements[indices[i]];                                              \
+}
+
+#define DEFINE_WRITE_FUNCTIONS(type, simd, name_as, ptr_type, as) \
+void port_memory_write##name_as##_##type##_strided(ptr_type memory,                 \
+        size_t offset, size_t stride, size_t count, const port_##type##_t *in)      \
+{                                                                                   \
+    as port_##type##_t *elements = (as port_##type##_t*)memory + offset;            \
+    for (size_t i = simd(write_strided, elements, stride, count, in); i < count; i++) \
+        elements[i * stride] = in[i];                                               \
+}                                                                                   \
+                                                                                    \
+void port_memory_scatter##name_as##_##type(ptr_type memory,                         \
+        const port_uint32_t *indices, size_t count, const port_##type##_t *in)      \
+{                                                                                   \
+    as port_##type##_t *elements = (as port_##type##_t*)memory;                     \
+    for (size_t i = simd(scatter, elements, indices, count, in); i < count; i++)    \
+        elements[indices[i]] = in[i];                                               \
+}
+
+#ifdef __OPENCL_C_VERSION__
+
+#define DEFINE_FUNCTIONS(type, simd) \
+    DEFINE_READ_FUNCTIONS(type, simd, , port_const_void_ptr_t, )                    \
+    DEFINE_READ_FUNCTIONS(type, simd, _local, port_const_local_void_ptr_t, __local) \
+    DEFINE_READ_FUNCTIONS(type, simd, _global, port_const_global_void_ptr_t, __global) \
+    DEFINE_READ_FUNCTIONS(type, simd, _constant, port_constant_void_ptr_t, __constant) \
+    DEFINE_WRITE_FUNCTIONS(type, simd, , port_void_ptr_t, )                         \
+    DEFINE_WRITE_FUNCTIONS(type, simd, _local, port_local_void_ptr_t, __local)      \
+    DEFINE_WRITE_FUNCTIONS(type, simd, _global, port_global_void_ptr_t, __global)
+
+#else // __OPENCL_C_VERSION__
+
+#define DEFINE_FUNCTIONS(type, simd) \
+    DEFINE_READ_FUNCTIONS(type, simd, , port_const_void_ptr_t, )                    \
+    DEFINE_WRITE_FUNCTIONS(type, simd, , port_void_ptr_t, )
+
+#endif // __OPENCL_C_VERSION__
+
+DEFINE_FUNCTIONS(uint8, SIMD_NONE)
+DEFINE_FUNCTIONS(uint16, SIMD_NONE)
+DEFINE_FUNCTIONS(uint32, SIMD_32)
+DEFINE_FUNCTIONS(uint64, SIMD_64)
+
+DEFINE_FUNCTIONS(sint8, SIMD_NONE)
+DEFINE_FUNCTIONS(sint16, SIMD_NONE)
+DEFINE_FUNCTIONS(sint32, SIMD_32)
+DEFINE_FUNCTIONS(sint64, SIMD_64)
+
+DEFINE_FUNCTIONS(float32, SIMD_32)
+DEFINE_FUNCTIONS(float64, SIMD_64)
+
+#undef DEFINE_FUNCTIONS
+#undef DEFINE_WRITE_FUNCTIONS
+#undef DEFINE_READ_FUNCTIONS
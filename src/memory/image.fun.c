@@ -0,0 +1,218 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Memory image files.
+ */
+
+#define _GNU_SOURCE // for pread(), fstat()
+
+#include "port/memory/image.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/table.fun.h"
+
+#include <stdio.h> // for fopen(), fwrite(), fseek(), fclose()
+#include <stdlib.h> // for malloc(), free()
+#include <string.h> // for memcmp(), memcpy()
+#include <fcntl.h> // for open()
+#include <sys/mman.h> // for mmap(), munmap()
+#include <sys/stat.h> // for fstat()
+#include <unistd.h> // for sysconf(), pread(), close()
+
+
+#define ROUND_UP(value, align) (((value) + (align) - 1) / (align) * (align))
+
+bool
+port_memory_image_write(
+        const char *path,
+        const port_memory_table_t *table,
+        size_t alignment)
+{
+    if ((path == NULL) || (table == NULL))
+        return false;
+
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+    if (alignment == 0)
+        alignment = page_size;
+    else if (((alignment & (alignment - 1)) != 0) || (alignment % page_size != 0))
+        return false;
+
+    port_memory_image_header_t header = {
+        .version = PORT_MEMORY_IMAGE_VERSION,
+        .byte_order = PORT_MEMORY_IMAGE_BYTE_ORDER,
+        .alignment = alignment,
+        .max_segment_size = table->max_segment_size,
+        .max_segments = table->capacity,
+        .num_segments = table->num_segments,
+        .far_num_tidx_bits = table->format.far.num_tidx_bits,
+        .far_offset_lshift = table->format.far.offset_lshift,
+        .near_offset_lshift = table->format.near.offset_lshift,
+    };
+    memcpy(header.magic, PORT_MEMORY_IMAGE_MAGIC, sizeof(header.magic));
+
+    port_memory_image_segment_t *segments = malloc(table->num_segments * sizeof(*segments) + 1);
+    if (segments == NULL)
+        return false;
+
+    size_t offset = ROUND_UP(sizeof(header) + table->num_segments * sizeof(*segments), alignment);
+    for (port_uint32_t i = 0; i < table->num_segments; i++)
+    {
+        if (table->segments[i].num_bytes == 0)
+        {
+            free(segments);
+            return false;
+        }
+
+        segments[i].offset = offset;
+        segments[i].num_bytes = table->segments[i].num_bytes;
+
+        offset = ROUND_UP(offset + table->segments[i].num_bytes, alignment);
+    }
+
+    bool success = false;
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+        goto cleanup;
+
+    if (fwrite(&header, sizeof(header), 1, file) != 1)
+        goto cleanup;
+    else if (fwrite(segments, sizeof(*segments), table->num_segments, file) != table->num_segments)
+        goto cleanup;
+
+    for (port_uint32_t i = 0; i < table->num_segments; i++)
+    {
+        if (fseek(file, segments[i].offset, SEEK_SET) != 0)
+            goto cleanup;
+        else if (fwrite(table->segments[i].memory, 1, segments[i].num_bytes, file) != segments[i].num_bytes)
+            goto cleanup;
+    }
+
+    success = true;
+
+cleanup:
+    if ((file != NULL) && (fclose(file) != 0))
+        success = false;
+
+    free(segments);
+    return success;
+}
+
+port_memory_table_t*
+port_memory_image_load(
+        const char *path,
+        bool writable)
+{
+    if (path == NULL)
+        return NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    port_memory_table_t *table = NULL;
+    port_memory_image_segment_t *segments = NULL;
+    bool success = false;
+
+    // Read and validate header
+    port_memory_image_header_t header;
+    struct stat st;
+
+    if (pread(fd, &header, sizeof(header), 0) != sizeof(header))
+        goto cleanup;
+    else if (fstat(fd, &st) != 0)
+        goto cleanup;
+
+    if (memcmp(header.magic, PORT_MEMORY_IMAGE_MAGIC, sizeof(header.magic)) != 0)
+        goto cleanup;
+    else if ((header.version != PORT_MEMORY_IMAGE_VERSION) || (header.byte_order != PORT_MEMORY_IMAGE_BYTE_ORDER))
+        goto cleanup;
+    else if ((header.alignment == 0) || (header.alignment % (size_t)sysconf(_SC_PAGESIZE) != 0))
+        goto cleanup;
+    else if (header.num_segments > header.max_segments)
+        goto cleanup;
+
+    table = port_memory_table_create(header.max_segments, header.max_segment_size);
+    if (table == NULL)
+        goto cleanup;
+
+    // the format is derived from the limits, so a mismatch means a corrupted or foreign image
+    if ((table->format.far.num_tidx_bits != header.far_num_tidx_bits) ||
+            (table->format.far.offset_lshift != header.far_offset_lshift) ||
+            (table->format.near.offset_lshift != header.near_offset_lshift))
+        goto cleanup;
+
+    // Read segment descriptors
+    size_t descriptors_size = header.num_segments * sizeof(*segments);
+
+    segments = malloc(descriptors_size + 1);
+    if (segments == NULL)
+        goto cleanup;
+    else if (pread(fd, segments, descriptors_size, sizeof(header)) != (ssize_t)descriptors_size)
+        goto cleanup;
+
+    // Map segments
+    for (port_uint32_t i = 0; i < header.num_segments; i++)
+    {
+        port_memory_image_segment_t segment = segments[i];
+
+        if ((segment.num_bytes == 0) || (segment.num_bytes > header.max_segment_size))
+            goto cleanup;
+        else if ((segment.offset % header.alignment != 0) ||
+                (segment.offset > (port_uint64_t)st.st_size) ||
+                (segment.num_bytes > (port_uint64_t)st.st_size - segment.offset))
+            goto cleanup;
+
+        void *memory = mmap(NULL, segment.num_bytes, PROT_READ | (writable ? PROT_WRITE : 0),
+                MAP_PRIVATE, fd, segment.offset);
+        if (memory == MAP_FAILED)
+            goto cleanup;
+
+        port_uint32_t tidx;
+        if (!port_memory_table_add_segment(table, memory, segment.num_bytes, &tidx))
+        {
+            munmap(memory, segment.num_bytes);
+            goto cleanup;
+        }
+
+        // the table takes ownership of the mapping
+        table->segments[tidx].mapping = memory;
+        table->segments[tidx].mapping_size = segment.num_bytes;
+    }
+
+    success = true;
+
+cleanup:
+    if (!success)
+    {
+        port_memory_table_destroy(table);
+        table = NULL;
+    }
+
+    free(segments);
+    close(fd);
+
+    return table;
+}
+
+#endif // __OPENCL_C_VERSION__
@@ -0,0 +1,263 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Fixed-size block pools.
+ */
+
+#include "port/memory/pool.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.fun.h"
+#include "port/memory.def.h"
+
+
+#define NEXT(pool, ref) \
+    ((port_memory_unit_t*)port_memory_pool_block((pool), (ref)))->PORT_MEMORY_UNIT__AS_REF
+
+#define LOCK(pool) while (atomic_flag_test_and_set_explicit(&(pool)->lock, memory_order_acquire))
+#define UNLOCK(pool) atomic_flag_clear_explicit(&(pool)->lock, memory_order_release)
+
+///////////////////////////////////////////////////////////////////////////////
+// Pool
+///////////////////////////////////////////////////////////////////////////////
+
+bool
+port_memory_pool_init(
+        port_memory_pool_t *pool,
+        port_memory_ref_format_t format,
+
+        port_void_ptr_t memory,
+        size_t num_bytes,
+        port_uint32_t tidx,
+
+        size_t block_units)
+{
+    if ((pool == NULL) || (memory == NULL) || (block_units == 0))
+        return false;
+
+    size_t far_align = ((size_t)1 << format.far.offset_lshift) / sizeof(port_memory_unit_t);
+    if (far_align == 0)
+        far_align = 1;
+
+    *pool = (port_memory_pool_t){.format = format, .memory = memory, .tidx = tidx,
+        .block_stride = (block_units + far_align - 1) / far_align * far_align,
+        .free_list = PORT_MEMORY_POOL_NIL};
+    atomic_flag_clear(&pool->lock);
+
+    size_t num_blocks = num_bytes / sizeof(port_memory_unit_t) / pool->block_stride;
+
+    // Link blocks in address order, stop at the first one that cannot be referenced
+    port_memory_ref_t *link = &pool->free_list;
+    for (size_t i = 0; i < num_blocks; i++)
+    {
+        port_memory_ref_t ref;
+        if (!port_memory_ref_encode_far(tidx, i * pool->block_stride * sizeof(port_memory_unit_t), format, &ref))
+            break;
+
+        *link = ref;
+        link = &pool->memory[i * pool->block_stride].PORT_MEMORY_UNIT__AS_REF;
+        *link = PORT_MEMORY_POOL_NIL;
+
+        pool->num_blocks++;
+    }
+
+    pool->num_free_blocks = pool->num_blocks;
+    return pool->num_blocks > 0;
+}
+
+port_void_ptr_t
+port_memory_pool_block(
+        const port_memory_pool_t *pool,
+        port_memory_ref_t ref)
+{
+    return (char*)pool->memory + ((size_t)PORT_MEMORY_REF_FAR__OFFSET(ref,
+                pool->format.far.num_tidx_bits) << pool->format.far.offset_lshift);
+}
+
+port_void_ptr_t
+port_memory_pool_alloc(
+        port_memory_pool_t *pool,
+
+        port_memory_ref_t *ref)
+{
+    if (pool == NULL)
+        return NULL;
+
+    LOCK(pool);
+
+    port_memory_ref_t head = pool->free_list;
+    if (head != PORT_MEMORY_POOL_NIL)
+    {
+        pool->free_list = NEXT(pool, head);
+        pool->num_free_blocks--;
+    }
+
+    UNLOCK(pool);
+
+    if (head == PORT_MEMORY_POOL_NIL)
+        return NULL;
+
+    if (ref != NULL)
+        *ref = head;
+
+    return port_memory_pool_block(pool, head);
+}
+
+void
+port_memory_pool_free(
+        port_memory_pool_t *pool,
+        port_memory_ref_t ref)
+{
+    if ((pool == NULL) || (ref == PORT_MEMORY_POOL_NIL))
+        return;
+
+    LOCK(pool);
+
+    NEXT(pool, ref) = pool->free_list;
+    pool->free_list = ref;
+    pool->num_free_blocks++;
+
+    UNLOCK(pool);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Thread-local cache
+///////////////////////////////////////////////////////////////////////////////
+
+static void
+cache_return(
+        port_memory_pool_cache_t *cache,
+        size_t num_blocks)
+{
+    port_memory_pool_t *pool = cache->pool;
+
+    // Detach the first num_blocks blocks from the local list
+    port_memory_ref_t head = cache->free_list;
+    port_memory_ref_t tail = head;
+    for (size_t i = 1; i < num_blocks; i++)
+        tail = NEXT(pool, tail);
+
+    cache->free_list = NEXT(pool, tail);
+    cache->num_free_blocks -= num_blocks;
+
+    LOCK(pool);
+
+    NEXT(pool, tail) = pool->free_list;
+    pool->free_list = head;
+    pool->num_free_blocks += num_blocks;
+
+    UNLOCK(pool);
+}
+
+void
+port_memory_pool_cache_init(
+        port_memory_pool_cache_t *cache,
+        port_memory_pool_t *pool,
+        size_t batch_size)
+{
+    if (cache == NULL)
+        return;
+
+    *cache = (port_memory_pool_cache_t){.pool = pool, .free_list = PORT_MEMORY_POOL_NIL,
+        .batch_size = (batch_size > 0) ? batch_size : 1};
+}
+
+port_void_ptr_t
+port_memory_pool_cache_alloc(
+        port_memory_pool_cache_t *cache,
+
+        port_memory_ref_t *ref)
+{
+    if (cache == NULL)
+        return NULL;
+
+    port_memory_pool_t *pool = cache->pool;
+
+    if (cache->free_list == PORT_MEMORY_POOL_NIL)
+    {
+        // Refill the local list with a batch of blocks
+        LOCK(pool);
+
+        port_memory_ref_t head = pool->free_list;
+        port_memory_ref_t tail = head;
+        size_t num_blocks = 0;
+
+        if (head != PORT_MEMORY_POOL_NIL)
+        {
+            num_blocks = 1;
+            while ((num_blocks < cache->batch_size) && (NEXT(pool, tail) != PORT_MEMORY_POOL_NIL))
+            {
+                tail = NEXT(pool, tail);
+                num_blocks++;
+            }
+
+            pool->free_list = NEXT(pool, tail);
+            pool->num_free_blocks -= num_blocks;
+        }
+
+        UNLOCK(pool);
+
+        if (num_blocks == 0)
+            return NULL;
+
+        NEXT(pool, tail) = PORT_MEMORY_POOL_NIL;
+        cache->free_list = head;
+        cache->num_free_blocks = num_blocks;
+    }
+
+    port_memory_ref_t head = cache->free_list;
+    cache->free_list = NEXT(pool, head);
+    cache->num_free_blocks--;
+
+    if (ref != NULL)
+        *ref = head;
+
+    return port_memory_pool_block(pool, head);
+}
+
+void
+port_memory_pool_cache_free(
+        port_memory_pool_cache_t *cache,
+        port_memory_ref_t ref)
+{
+    if ((cache == NULL) || (ref == PORT_MEMORY_POOL_NIL))
+        return;
+
+    NEXT(cache->pool, ref) = cache->free_list;
+    cache->free_list = ref;
+    cache->num_free_blocks++;
+
+    if (cache->num_free_blocks >= 2 * cache->batch_size)
+        cache_return(cache, cache->batch_size);
+}
+
+void
+port_memory_pool_cache_flush(
+        port_memory_pool_cache_t *cache)
+{
+    if ((cache == NULL) || (cache->num_free_blocks == 0))
+        return;
+
+    cache_return(cache, cache->num_free_blocks);
+}
+
+#endif // __OPENCL_C_VERSION__
@@ -0,0 +1,316 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Profiling of memory reference resolution.
+ */
+
+#include "port/memory/profile.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.def.h"
+
+#include <stdlib.h> // for calloc(), malloc(), free()
+#include <stdint.h> // for uintptr_t
+#include <stdatomic.h>
+
+
+#define NUM_WATCHES_LOG2    6
+#define NUM_WATCHES         (1 << NUM_WATCHES_LOG2)
+#define CACHE_LINE_LSHIFT   6
+
+#define NUM_BUCKETS PORT_MEMORY_PROFILE_NUM_LOG2_BUCKETS
+
+// Only the owner thread increments counters, so increment is not atomic as a whole;
+// atomic loads and stores are needed only for reading counters from other threads.
+#define INC(counter) atomic_store_explicit(&(counter), \
+        atomic_load_explicit(&(counter), memory_order_relaxed) + 1, memory_order_relaxed)
+
+#define LOAD(counter) atomic_load_explicit(&(counter), memory_order_relaxed)
+
+typedef struct thread_profile {
+    _Atomic port_uint64_t num_near;
+    _Atomic port_uint64_t num_far;
+
+    _Atomic port_uint64_t tidx_hits[PORT_MEMORY_PROFILE_NUM_TIDX];
+    _Atomic port_uint64_t tidx_hits_other;
+
+    _Atomic port_uint64_t near_offset_log2[NUM_BUCKETS];
+    _Atomic port_uint64_t far_offset_log2[NUM_BUCKETS];
+
+    _Atomic port_uint64_t num_reuse_samples;
+    _Atomic port_uint64_t reuse_distance_log2[NUM_BUCKETS];
+
+    // accessed by the owner thread only
+    port_uint64_t clock;
+    struct {
+        uintptr_t line;
+        port_uint64_t time; // 0 if the watch is free
+    } watches[NUM_WATCHES];
+
+    struct thread_profile *next;
+} thread_profile_t;
+
+// Profiles are never freed, so statistics of finished threads are kept
+static _Atomic(thread_profile_t*) profiles;
+static _Thread_local thread_profile_t *thread_profile;
+
+// Statistics at the moment of the last reset
+static port_memory_profile_t baseline;
+static atomic_flag baseline_lock = ATOMIC_FLAG_INIT;
+
+static unsigned
+log2_bucket(
+        port_uint64_t value)
+{
+#ifdef __GNUC__
+    return (value != 0) ? 64 - __builtin_clzll(value) : 0;
+#else
+    unsigned bucket = 0;
+    for (; value != 0; value >>= 1)
+        bucket++;
+    return bucket;
+#endif
+}
+
+static thread_profile_t*
+get_thread_profile(void)
+{
+    thread_profile_t *profile = thread_profile;
+
+    if (profile == NULL)
+    {
+        profile = calloc(1, sizeof(*profile));
+        if (profile == NULL)
+            return NULL;
+
+        thread_profile_t *head = atomic_load_explicit(&profiles, memory_order_relaxed);
+        do
+            profile->next = head;
+        while (!atomic_compare_exchange_weak_explicit(&profiles, &head, profile,
+                    memory_order_release, memory_order_relaxed));
+
+        thread_profile = profile;
+    }
+
+    return profile;
+}
+
+static void
+sum_profiles(
+        port_memory_profile_t *sum)
+{
+    *sum = (port_memory_profile_t){0};
+
+    for (thread_profile_t *p = atomic_load_explicit(&profiles, memory_order_acquire); p != NULL; p = p->next)
+    {
+        sum->num_near += LOAD(p->num_near);
+        sum->num_far += LOAD(p->num_far);
+
+        for (size_t i = 0; i < PORT_MEMORY_PROFILE_NUM_TIDX; i++)
+            sum->tidx_hits[i] += LOAD(p->tidx_hits[i]);
+        sum->tidx_hits_other += LOAD(p->tidx_hits_other);
+
+        for (size_t i = 0; i < NUM_BUCKETS; i++)
+        {
+            sum->near_offset_log2[i] += LOAD(p->near_offset_log2[i]);
+            sum->far_offset_log2[i] += LOAD(p->far_offset_log2[i]);
+            sum->reuse_distance_log2[i] += LOAD(p->reuse_distance_log2[i]);
+        }
+        sum->num_reuse_samples += LOAD(p->num_reuse_samples);
+    }
+}
+
+port_const_void_ptr_t
+port_memory_profile_record(
+        port_memory_ref_t ref,
+        port_memory_ref_format_t format,
+        port_const_void_ptr_t ptr)
+{
+    thread_profile_t *p = get_thread_profile();
+    if (p == NULL)
+        return ptr;
+
+    if (PORT_MEMORY_REF_IS_FAR(ref))
+    {
+        INC(p->num_far);
+
+        port_uint32_t tidx = PORT_MEMORY_REF_FAR__TABLE_INDEX(ref, format.far.num_tidx_bits);
+        if (tidx < PORT_MEMORY_PROFILE_NUM_TIDX)
+            INC(p->tidx_hits[tidx]);
+        else
+            INC(p->tidx_hits_other);
+
+        INC(p->far_offset_log2[log2_bucket((port_uint64_t)PORT_MEMORY_REF_FAR__OFFSET(
+                        ref, format.far.num_tidx_bits) << format.far.offset_lshift)]);
+    }
+    else
+    {
+        INC(p->num_near);
+        INC(p->near_offset_log2[log2_bucket((port_uint64_t)(-(port_sint64_t)ref) << format.near.offset_lshift)]);
+    }
+
+    // Sample reuse distance
+    uintptr_t line = (uintptr_t)ptr >> CACHE_LINE_LSHIFT;
+    size_t watch = (size_t)(((port_uint64_t)line * 0x9E3779B97F4A7C15ull) >> (64 - NUM_WATCHES_LOG2));
+
+    p->clock++;
+
+    if ((p->watches[watch].time != 0) && (p->watches[watch].line == line))
+    {
+        INC(p->num_reuse_samples);
+        INC(p->reuse_distance_log2[log2_bucket(p->clock - p->watches[watch].time)]);
+
+        p->watches[watch].time = 0;
+    }
+
+    if (p->clock % PORT_MEMORY_PROFILE_SAMPLE_PERIOD == 0)
+    {
+        p->watches[watch].line = line;
+        p->watches[watch].time = p->clock;
+    }
+
+    return ptr;
+}
+
+void
+port_memory_profile_collect(
+        port_memory_profile_t *profile)
+{
+    if (profile == NULL)
+        return;
+
+    sum_profiles(profile);
+
+    while (atomic_flag_test_and_set_explicit(&baseline_lock, memory_order_acquire));
+
+    profile->num_near -= baseline.num_near;
+    profile->num_far -= baseline.num_far;
+
+    for (size_t i = 0; i < PORT_MEMORY_PROFILE_NUM_TIDX; i++)
+        profile->tidx_hits[i] -= baseline.tidx_hits[i];
+    profile->tidx_hits_other -= baseline.tidx_hits_other;
+
+    for (size_t i = 0; i < NUM_BUCKETS; i++)
+    {
+        profile->near_offset_log2[i] -= baseline.near_offset_log2[i];
+        profile->far_offset_log2[i] -= baseline.far_offset_log2[i];
+        profile->reuse_distance_log2[i] -= baseline.reuse_distance_log2[i];
+    }
+    profile->num_reuse_samples -= baseline.num_reuse_samples;
+
+    atomic_flag_clear_explicit(&baseline_lock, memory_order_release);
+}
+
+void
+port_memory_profile_reset(void)
+{
+    port_memory_profile_t sum;
+    sum_profiles(&sum);
+
+    while (atomic_flag_test_and_set_explicit(&baseline_lock, memory_order_acquire));
+    baseline = sum;
+    atomic_flag_clear_explicit(&baseline_lock, memory_order_release);
+}
+
+static void
+report_histogram(
+        FILE *file,
+        const char *title,
+        const port_uint64_t histogram[],
+        port_uint64_t total)
+{
+    fprintf(file, "%s:\n", title);
+
+    for (unsigned i = 0; i < NUM_BUCKETS; i++)
+    {
+        if (histogram[i] == 0)
+            continue;
+
+        if (i == 0)
+            fprintf(file, "  0");
+        else
+            fprintf(file, "  [2^%u; 2^%u)", i - 1, i);
+
+        fprintf(file, ": %llu (%.2f%%)\n", (unsigned long long)histogram[i],
+                100.0 * histogram[i] / total);
+    }
+}
+
+void
+port_memory_profile_report(
+        FILE *file)
+{
+    if (file == NULL)
+        return;
+
+    port_memory_profile_t *profile = malloc(sizeof(*profile));
+    if (profile == NULL)
+        return;
+
+    port_memory_profile_collect(profile);
+
+    port_uint64_t total = profile->num_near + profile->num_far;
+    if (total == 0)
+    {
+        fprintf(file, "memory references: no resolutions\n");
+        free(profile);
+        return;
+    }
+
+    fprintf(file, "memory references: %llu resolutions (near: %llu (%.2f%%), far: %llu (%.2f%%))\n",
+            (unsigned long long)total,
+            (unsigned long long)profile->num_near, 100.0 * profile->num_near / total,
+            (unsigned long long)profile->num_far, 100.0 * profile->num_far / total);
+
+    if (profile->num_far > 0)
+    {
+        fprintf(file, "far resolutions by table index:\n");
+
+        for (size_t i = 0; i < PORT_MEMORY_PROFILE_NUM_TIDX; i++)
+            if (profile->tidx_hits[i] != 0)
+                fprintf(file, "  %zu: %llu (%.2f%%)\n", i, (unsigned long long)profile->tidx_hits[i],
+                        100.0 * profile->tidx_hits[i] / profile->num_far);
+
+        if (profile->tidx_hits_other != 0)
+            fprintf(file, "  >= %u: %llu (%.2f%%)\n", (unsigned)PORT_MEMORY_PROFILE_NUM_TIDX,
+                    (unsigned long long)profile->tidx_hits_other,
+                    100.0 * profile->tidx_hits_other / profile->num_far);
+
+        report_histogram(file, "far byte offsets", profile->far_offset_log2, profile->num_far);
+    }
+
+    if (profile->num_near > 0)
+        report_histogram(file, "near byte offsets", profile->near_offset_log2, profile->num_near);
+
+    if (profile->num_reuse_samples > 0)
+    {
+        char title[64];
+        snprintf(title, sizeof(title), "reuse distance in resolutions (%llu samples)",
+                (unsigned long long)profile->num_reuse_samples);
+
+        report_histogram(file, title, profile->reuse_distance_log2, profile->num_reuse_samples);
+    }
+
+    free(profile);
+}
+
+#endif // __OPENCL_C_VERSION__
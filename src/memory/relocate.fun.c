@@ -0,0 +1,420 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Relocation of memory unit graphs.
+ */
+
+#include "port/memory/relocate.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory.fun.h"
+#include "port/memory.def.h"
+
+#include <stdlib.h> // for malloc(), realloc(), aligned_alloc(), free()
+#include <string.h> // for memcpy(), memset()
+#include <stdint.h> // for uintptr_t, SIZE_MAX
+
+
+#define ROUND_UP(value, align) (((value) + (align) - 1) / (align) * (align))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+#define NOT_FOUND SIZE_MAX
+
+typedef struct node {
+    const port_memory_unit_t *memory; // source node
+    port_memory_ref_map_t map;
+
+    size_t first_target; // index of the first reference target
+    size_t first_referrer; // index of the first node with forward reference to this node
+    size_t offset; // byte offset in the new segment
+    bool far_target; // whether the node is referenced with far references
+} node_t;
+
+typedef struct relocation {
+    port_memory_ref_format_t format;
+    const port_const_void_ptr_t *memory_table;
+    port_memory_relocation_params_t params;
+
+    node_t *nodes;
+    size_t num_nodes, nodes_capacity;
+
+    size_t *targets; // node indices of reference targets
+    size_t num_targets, targets_capacity;
+
+    const port_memory_unit_t **stack;
+    size_t stack_size, stack_capacity;
+
+    // open addressing hash map: source node -> node index
+    const port_memory_unit_t **keys;
+    size_t *values;
+    size_t map_capacity;
+} relocation_t;
+
+static bool
+reserve(
+        void **array,
+        size_t *capacity,
+        size_t element_size,
+        size_t size)
+{
+    if (size <= *capacity)
+        return true;
+
+    size_t new_capacity = (*capacity > 0) ? *capacity : 16;
+    while (new_capacity < size)
+        new_capacity *= 2;
+
+    void *new_array = realloc(*array, new_capacity * element_size);
+    if (new_array == NULL)
+        return false;
+
+    *array = new_array;
+    *capacity = new_capacity;
+    return true;
+}
+
+static size_t
+map_slot(
+        const relocation_t *r,
+        const port_memory_unit_t *key)
+{
+    uint64_t hash = (uintptr_t)key;
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+
+    size_t slot = hash & (r->map_capacity - 1);
+    while ((r->keys[slot] != NULL) && (r->keys[slot] != key))
+        slot = (slot + 1) & (r->map_capacity - 1);
+
+    return slot;
+}
+
+static size_t
+map_lookup(
+        const relocation_t *r,
+        const port_memory_unit_t *key)
+{
+    if (r->map_capacity == 0)
+        return NOT_FOUND;
+
+    size_t slot = map_slot(r, key);
+    return (r->keys[slot] != NULL) ? r->values[slot] : NOT_FOUND;
+}
+
+static bool
+map_insert(
+        relocation_t *r,
+        const port_memory_unit_t *key,
+        size_t value)
+{
+    if (2 * (r->num_nodes + 1) > r->map_capacity) // keep load factor <= 1/2
+    {
+        const port_memory_unit_t **old_keys = r->keys;
+        size_t *old_values = r->values;
+        size_t old_capacity = r->map_capacity;
+
+        r->map_capacity = (old_capacity > 0) ? 2 * old_capacity : 64;
+        r->keys = calloc(r->map_capacity, sizeof(*r->keys));
+        r->values = malloc(r->map_capacity * sizeof(*r->values));
+
+        if ((r->keys == NULL) || (r->values == NULL))
+        {
+            free(r->keys);
+            free(r->values);
+
+            r->keys = old_keys;
+            r->values = old_values;
+            r->map_capacity = old_capacity;
+            return false;
+        }
+
+        for (size_t i = 0; i < old_capacity; i++)
+            if (old_keys[i] != NULL)
+            {
+                size_t slot = map_slot(r, old_keys[i]);
+                r->keys[slot] = old_keys[i];
+                r->values[slot] = old_values[i];
+            }
+
+        free(old_keys);
+        free(old_values);
+    }
+
+    size_t slot = map_slot(r, key);
+    r->keys[slot] = key;
+    r->values[slot] = value;
+    return true;
+}
+
+static const port_memory_unit_t*
+resolve(
+        const relocation_t *r,
+        port_memory_ref_t ref,
+        port_const_void_ptr_t base_ptr)
+{
+    // not port_memory_at(), lookups of the library itself must not be profiled
+    return (const port_memory_unit_t*)PORT_MEMORY_AT(ref, r->format.far.num_tidx_bits, r->format.far.offset_lshift,
+            r->format.near.offset_lshift, (port_const_char_ptr_t)base_ptr,
+            (const port_const_char_ptr_t*)r->memory_table);
+}
+
+static const port_memory_unit_t*
+resolve_ref(
+        const relocation_t *r,
+        const node_t *node,
+        port_uint32_t k)
+{
+    return resolve(r, node->memory[node->map.ref_units[k]].PORT_MEMORY_UNIT__AS_REF, node->memory);
+}
+
+static bool
+add_node(
+        relocation_t *r,
+        const port_memory_unit_t *memory)
+{
+    if (map_lookup(r, memory) != NOT_FOUND)
+        return true;
+
+    node_t node = {.memory = memory, .first_referrer = NOT_FOUND};
+    if (!r->params.node_map_fn(memory, r->params.node_map_data, &node.map))
+        return false;
+
+    for (port_uint32_t k = 0; k < node.map.num_refs; k++)
+        if (node.map.ref_units[k] >= node.map.num_units)
+            return false;
+
+    if (!reserve((void**)&r->nodes, &r->nodes_capacity, sizeof(*r->nodes), r->num_nodes + 1))
+        return false;
+    else if (!map_insert(r, memory, r->num_nodes))
+        return false;
+
+    r->nodes[r->num_nodes++] = node;
+    return true;
+}
+
+static bool
+push(
+        relocation_t *r,
+        const port_memory_unit_t *memory)
+{
+    if (!reserve((void**)&r->stack, &r->stack_capacity, sizeof(*r->stack), r->stack_size + 1))
+        return false;
+
+    r->stack[r->stack_size++] = memory;
+    return true;
+}
+
+static bool
+traverse(
+        relocation_t *r,
+        const port_memory_ref_t roots[],
+        size_t num_roots,
+        port_const_void_ptr_t base_ptr)
+{
+    if (r->params.order == PORT_MEMORY_RELOCATION_BFS)
+    {
+        for (size_t i = 0; i < num_roots; i++)
+            if (!add_node(r, resolve(r, roots[i], base_ptr)))
+                return false;
+
+        // the node array is the queue
+        for (size_t i = 0; i < r->num_nodes; i++)
+            for (port_uint32_t k = 0; k < r->nodes[i].map.num_refs; k++)
+                if (!add_node(r, resolve_ref(r, &r->nodes[i], k)))
+                    return false;
+    }
+    else if (r->params.order == PORT_MEMORY_RELOCATION_DFS)
+    {
+        for (size_t i = num_roots; i-- > 0;)
+            if (!push(r, resolve(r, roots[i], base_ptr)))
+                return false;
+
+        while (r->stack_size > 0)
+        {
+            const port_memory_unit_t *memory = r->stack[--r->stack_size];
+            if (map_lookup(r, memory) != NOT_FOUND)
+                continue;
+
+            if (!add_node(r, memory))
+                return false;
+
+            const node_t *node = &r->nodes[r->num_nodes - 1];
+            for (port_uint32_t k = node->map.num_refs; k-- > 0;)
+            {
+                const port_memory_unit_t *target = resolve_ref(r, node, k);
+
+                if ((map_lookup(r, target) == NOT_FOUND) && !push(r, target))
+                    return false;
+            }
+        }
+    }
+    else
+        return false;
+
+    return true;
+}
+
+static bool
+collect_targets(
+        relocation_t *r,
+        const port_memory_ref_t roots[],
+        size_t num_roots,
+        port_const_void_ptr_t base_ptr)
+{
+    for (size_t i = 0; i < num_roots; i++)
+        r->nodes[map_lookup(r, resolve(r, roots[i], base_ptr))].far_target = true;
+
+    for (size_t i = 0; i < r->num_nodes; i++)
+    {
+        node_t *node = &r->nodes[i];
+
+        if (!reserve((void**)&r->targets, &r->targets_capacity, sizeof(*r->targets),
+                    r->num_targets + node->map.num_refs))
+            return false;
+
+        node->first_target = r->num_targets;
+
+        for (port_uint32_t k = 0; k < node->map.num_refs; k++)
+        {
+            size_t target = map_lookup(r, resolve_ref(r, node, k));
+
+            // backward references cannot be near
+            if (target <= i)
+                r->nodes[target].far_target = true;
+            else if (r->nodes[target].first_referrer == NOT_FOUND)
+                r->nodes[target].first_referrer = i;
+
+            r->targets[r->num_targets++] = target;
+        }
+    }
+
+    return true;
+}
+
+bool
+port_memory_relocate(
+        const port_memory_ref_t roots[],
+        size_t num_roots,
+
+        port_memory_ref_format_t format,
+        port_const_void_ptr_t base_ptr,
+        const port_const_void_ptr_t *memory_table,
+
+        port_memory_relocation_params_t params,
+
+        port_memory_ref_t new_roots[],
+        port_memory_relocation_t *result)
+{
+    if (((roots == NULL) || (new_roots == NULL)) && (num_roots > 0))
+        return false;
+    else if ((memory_table == NULL) || (params.node_map_fn == NULL) || (result == NULL))
+        return false;
+    else if ((params.new_tidx >> format.far.num_tidx_bits) != 0)
+        return false;
+
+    relocation_t r = {.format = format, .memory_table = memory_table, .params = params};
+    port_memory_relocation_t res = {0};
+    bool success = false;
+
+    if (!traverse(&r, roots, num_roots, base_ptr))
+        goto cleanup;
+    else if (!collect_targets(&r, roots, num_roots, base_ptr))
+        goto cleanup;
+
+    // Place nodes
+    size_t near_align = MAX(sizeof(port_memory_unit_t), (size_t)1 << format.near.offset_lshift);
+    size_t far_align = MAX(near_align, (size_t)1 << format.far.offset_lshift);
+
+    for (size_t i = 0; i < r.num_nodes; i++)
+    {
+        node_t *node = &r.nodes[i];
+        node->offset = ROUND_UP(res.num_bytes, node->far_target ? far_align : near_align);
+
+        // the first referrer is the farthest one, if its near reference does not fit, the node needs far references
+        if (!node->far_target && (node->first_referrer != NOT_FOUND) &&
+                !port_memory_ref_encode_near(node->offset - r.nodes[node->first_referrer].offset, format, NULL))
+        {
+            node->far_target = true;
+            node->offset = ROUND_UP(res.num_bytes, far_align);
+        }
+
+        res.num_bytes = node->offset + node->map.num_units * sizeof(port_memory_unit_t);
+    }
+
+    if (res.num_bytes > 0)
+    {
+        size_t num_bytes = ROUND_UP(res.num_bytes, far_align);
+
+        res.segment = aligned_alloc(far_align, num_bytes);
+        if (res.segment == NULL)
+            goto cleanup;
+
+        memset(res.segment, 0, num_bytes);
+    }
+
+    // Copy nodes and rewrite references
+    for (size_t i = 0; i < r.num_nodes; i++)
+    {
+        const node_t *node = &r.nodes[i];
+        port_memory_unit_t *new_node = (port_memory_unit_t*)((char*)res.segment + node->offset);
+
+        memcpy(new_node, node->memory, node->map.num_units * sizeof(port_memory_unit_t));
+
+        for (port_uint32_t k = 0; k < node->map.num_refs; k++)
+        {
+            const node_t *target = &r.nodes[r.targets[node->first_target + k]];
+            port_memory_ref_t *ref = &new_node[node->map.ref_units[k]].PORT_MEMORY_UNIT__AS_REF;
+
+            if ((target > node) && port_memory_ref_encode_near(target->offset - node->offset, format, ref))
+                res.num_near_refs++;
+            else if (port_memory_ref_encode_far(params.new_tidx, target->offset, format, ref))
+                res.num_far_refs++;
+            else
+                goto cleanup;
+        }
+    }
+
+    for (size_t i = 0; i < num_roots; i++)
+        if (!port_memory_ref_encode_far(params.new_tidx,
+                    r.nodes[map_lookup(&r, resolve(&r, roots[i], base_ptr))].offset, format, &new_roots[i]))
+            goto cleanup;
+
+    res.num_nodes = r.num_nodes;
+    success = true;
+
+cleanup:
+    if (success)
+        *result = res;
+    else
+        free(res.segment);
+
+    free(r.nodes);
+    free(r.targets);
+    free(r.stack);
+    free(r.keys);
+    free(r.values);
+
+    return success;
+}
+
+#endif // __OPENCL_C_VERSION__
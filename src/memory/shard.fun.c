@@ -0,0 +1,240 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Memory tables sharded between processes through POSIX shared memory.
+ */
+
+#define _GNU_SOURCE // for shm_open(), ftruncate(), strdup()
+
+#include "port/memory/shard.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/table.fun.h"
+#include "port/memory.def.h"
+
+#include <stdio.h> // for snprintf()
+#include <stdlib.h> // for malloc(), free()
+#include <string.h> // for strdup(), strchr()
+#include <fcntl.h> // for O_* constants
+#include <sys/mman.h> // for shm_open(), shm_unlink(), mmap(), munmap()
+#include <sys/stat.h> // for fstat()
+#include <unistd.h> // for ftruncate(), close()
+
+
+#define OBJECT_NAME_SIZE 256
+
+static bool
+object_name(
+        const port_memory_shards_t *shards,
+        port_uint32_t tidx,
+        char name[OBJECT_NAME_SIZE])
+{
+    int len = snprintf(name, OBJECT_NAME_SIZE, "/%s.%lu", shards->name, (unsigned long)tidx);
+    return (len > 0) && (len < OBJECT_NAME_SIZE);
+}
+
+static void
+register_segment(
+        port_memory_shards_t *shards,
+        port_uint32_t tidx,
+        port_void_ptr_t memory,
+        size_t num_bytes)
+{
+    shards->table->pointers[tidx] = memory;
+    shards->table->segments[tidx] = (port_memory_segment_t){
+        .memory = memory, .num_bytes = num_bytes,
+        .mapping = memory, .mapping_size = num_bytes,
+    };
+}
+
+port_memory_shards_t*
+port_memory_shards_create(
+        const char *name,
+        port_uint32_t num_shards,
+        port_uint32_t shard,
+        port_uint32_t max_segments,
+        size_t max_segment_size)
+{
+    if ((name == NULL) || (name[0] == '\0') || (strchr(name, '/') != NULL) ||
+            (num_shards == 0) || (shard >= num_shards) || (max_segments < num_shards))
+        return NULL;
+
+    port_memory_shards_t *shards = malloc(sizeof(*shards));
+    if (shards == NULL)
+        return NULL;
+
+    *shards = (port_memory_shards_t){
+        .name = strdup(name),
+        .num_shards = num_shards,
+        .shard = shard,
+        .tidx_per_shard = (max_segments + num_shards - 1) / num_shards,
+        .table = port_memory_table_create(max_segments, max_segment_size),
+    };
+
+    if ((shards->name == NULL) || (shards->table == NULL))
+    {
+        port_memory_shards_destroy(shards, false);
+        return NULL;
+    }
+
+    // all table indices are in use, segments not mapped yet are NULL
+    shards->table->num_segments = shards->table->capacity;
+
+    return shards;
+}
+
+void
+port_memory_shards_destroy(
+        port_memory_shards_t *shards,
+        bool unlink)
+{
+    if (shards == NULL)
+        return;
+
+    if (unlink && (shards->table != NULL))
+    {
+        char name[OBJECT_NAME_SIZE];
+
+        for (port_uint32_t tidx = 0; tidx < shards->table->capacity; tidx++)
+            if ((shards->table->pointers[tidx] != NULL) &&
+                    (port_memory_shards_owner(shards, tidx) == shards->shard) &&
+                    object_name(shards, tidx, name))
+                shm_unlink(name);
+    }
+
+    port_memory_table_destroy(shards->table);
+    free(shards->name);
+    free(shards);
+}
+
+port_uint32_t
+port_memory_shards_owner(
+        const port_memory_shards_t *shards,
+        port_uint32_t tidx)
+{
+    return tidx / shards->tidx_per_shard;
+}
+
+port_uint32_t
+port_memory_shards_ref_owner(
+        const port_memory_shards_t *shards,
+        port_memory_ref_t ref,
+        port_uint32_t base_tidx)
+{
+    if (!PORT_MEMORY_REF_IS_FAR(ref))
+        return port_memory_shards_owner(shards, base_tidx);
+
+    return port_memory_shards_owner(shards,
+            PORT_MEMORY_REF_FAR__TABLE_INDEX(ref, shards->table->format.far.num_tidx_bits));
+}
+
+port_void_ptr_t
+port_memory_shards_alloc_segment(
+        port_memory_shards_t *shards,
+        port_uint32_t tidx,
+        size_t num_bytes)
+{
+    if ((shards == NULL) || (tidx >= shards->table->capacity) ||
+            (port_memory_shards_owner(shards, tidx) != shards->shard) ||
+            (shards->table->pointers[tidx] != NULL) ||
+            (num_bytes == 0) || (num_bytes > shards->table->max_segment_size))
+        return NULL;
+
+    char name[OBJECT_NAME_SIZE];
+    if (!object_name(shards, tidx, name))
+        return NULL;
+
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+        return NULL;
+
+    port_void_ptr_t memory = MAP_FAILED;
+    if (ftruncate(fd, (off_t)num_bytes) == 0)
+        memory = mmap(NULL, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        shm_unlink(name);
+        return NULL;
+    }
+
+    register_segment(shards, tidx, memory, num_bytes);
+    return memory;
+}
+
+port_const_void_ptr_t
+port_memory_shards_attach_segment(
+        port_memory_shards_t *shards,
+        port_uint32_t tidx)
+{
+    if ((shards == NULL) || (tidx >= shards->table->capacity) ||
+            (port_memory_shards_owner(shards, tidx) == shards->shard))
+        return NULL;
+
+    if (shards->table->pointers[tidx] != NULL)
+        return shards->table->pointers[tidx];
+
+    char name[OBJECT_NAME_SIZE];
+    if (!object_name(shards, tidx, name))
+        return NULL;
+
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+        return NULL;
+
+    port_void_ptr_t memory = MAP_FAILED;
+    struct stat st;
+
+    if ((fstat(fd, &st) == 0) && (st.st_size > 0) &&
+            ((size_t)st.st_size <= shards->table->max_segment_size))
+        memory = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+
+    if (memory == MAP_FAILED)
+        return NULL;
+
+    register_segment(shards, tidx, memory, (size_t)st.st_size);
+    return memory;
+}
+
+port_uint32_t
+port_memory_shards_attach_all(
+        port_memory_shards_t *shards)
+{
+    if (shards == NULL)
+        return 0;
+
+    port_uint32_t num_attached = 0;
+
+    for (port_uint32_t tidx = 0; tidx < shards->table->capacity; tidx++)
+        if ((shards->table->pointers[tidx] == NULL) &&
+                (port_memory_shards_owner(shards, tidx) != shards->shard) &&
+                (port_memory_shards_attach_segment(shards, tidx) != NULL))
+            num_attached++;
+
+    return num_attached;
+}
+
+#endif // __OPENCL_C_VERSION__
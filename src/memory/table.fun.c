@@ -0,0 +1,309 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Host-side memory table management.
+ */
+
+#define _GNU_SOURCE // for MAP_ANONYMOUS, MAP_HUGETLB, MADV_HUGEPAGE, syscall()
+
+#include "port/memory/table.fun.h"
+
+#ifndef __OPENCL_C_VERSION__
+
+#include "port/memory/unit.typ.h"
+#include "port/bit.def.h"
+
+#include <stdio.h> // for fopen(), fgets(), sscanf()
+#include <stdlib.h> // for malloc(), calloc(), free()
+#include <stdint.h> // for uintptr_t
+#include <sys/mman.h> // for mmap(), munmap(), madvise()
+#include <sys/syscall.h> // for SYS_mbind
+#include <unistd.h> // for sysconf(), syscall()
+
+
+#define DEFAULT_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+#define NUMA_MPOL_BIND      2 // MPOL_BIND from <numaif.h>
+#define NUMA_MPOL_MF_STRICT 1 // MPOL_MF_STRICT from <numaif.h>
+#define NUMA_MAX_NODES      1024
+
+#define ROUND_UP(value, align) (((value) + (align) - 1) / (align) * (align))
+
+static size_t
+huge_page_size(void)
+{
+    size_t size = DEFAULT_HUGE_PAGE_SIZE;
+
+    FILE *file = fopen("/proc/meminfo", "r");
+    if (file != NULL)
+    {
+        char line[128];
+        unsigned long size_kb;
+
+        while (fgets(line, sizeof(line), file) != NULL)
+            if (sscanf(line, "Hugepagesize: %lu kB", &size_kb) == 1)
+            {
+                size = (size_t)size_kb << 10;
+                break;
+            }
+
+        fclose(file);
+    }
+
+    return size;
+}
+
+static bool
+bind_to_numa_node(
+        port_void_ptr_t memory,
+        size_t num_bytes,
+        int numa_node)
+{
+#ifdef SYS_mbind
+    if (numa_node >= NUMA_MAX_NODES)
+        return false;
+
+    unsigned long nodemask[NUMA_MAX_NODES / PORT_NUM_BITS(unsigned long)] = {0};
+    nodemask[numa_node / PORT_NUM_BITS(unsigned long)] |= 1ul << (numa_node % PORT_NUM_BITS(unsigned long));
+
+    return syscall(SYS_mbind, memory, num_bytes, NUMA_MPOL_BIND,
+            nodemask, (unsigned long)NUMA_MAX_NODES, NUMA_MPOL_MF_STRICT) == 0;
+#else
+    (void) memory;
+    (void) num_bytes;
+    (void) numa_node;
+
+    return false;
+#endif
+}
+
+static bool
+add_segment(
+        port_memory_table_t *table,
+        port_memory_segment_t segment,
+        port_uint32_t *tidx)
+{
+    if (table->num_segments == table->capacity)
+        return false;
+
+    table->pointers[table->num_segments] = segment.memory;
+    table->segments[table->num_segments] = segment;
+
+    if (tidx != NULL)
+        *tidx = table->num_segments;
+
+    table->num_segments++;
+    return true;
+}
+
+bool
+port_memory_table_format(
+        port_uint32_t max_segments,
+        size_t max_segment_size,
+
+        port_memory_ref_format_t *format)
+{
+    if ((max_segments == 0) || (format == NULL))
+        return false;
+
+    port_uint8_t unit_lshift = 0;
+    while ((sizeof(port_memory_unit_t) >> unit_lshift) > 1)
+        unit_lshift++;
+
+    port_uint8_t num_tidx_bits = 0;
+    while ((num_tidx_bits < PORT_NUM_BITS(port_memory_ref_t) - 1) &&
+            (((port_uint32_t)1 << num_tidx_bits) < max_segments))
+        num_tidx_bits++;
+
+    // at least one bit is needed for the offset, and one is taken by the sign
+    if (num_tidx_bits > PORT_NUM_BITS(port_memory_ref_t) - 2)
+        return false;
+
+    port_uint8_t num_offset_bits = PORT_NUM_BITS(port_memory_ref_t) - 1 - num_tidx_bits;
+    size_t max_offset = (max_segment_size > 0) ? max_segment_size - 1 : 0;
+
+    port_uint8_t far_offset_lshift = unit_lshift;
+    while ((max_offset >> far_offset_lshift) >> num_offset_bits)
+        far_offset_lshift++;
+
+    format->far.num_tidx_bits = num_tidx_bits;
+    format->far.offset_lshift = far_offset_lshift;
+    format->near.offset_lshift = unit_lshift;
+
+    return true;
+}
+
+port_memory_table_t*
+port_memory_table_create(
+        port_uint32_t max_segments,
+        size_t max_segment_size)
+{
+    port_memory_ref_format_t format;
+    if (!port_memory_table_format(max_segments, max_segment_size, &format))
+        return NULL;
+
+    port_memory_table_t *table = malloc(sizeof(*table));
+    if (table == NULL)
+        return NULL;
+
+    *table = (port_memory_table_t){
+        .format = format,
+        .max_segment_size = max_segment_size,
+        .capacity = max_segments,
+        .pointers = calloc(max_segments, sizeof(*table->pointers)),
+        .segments = calloc(max_segments, sizeof(*table->segments)),
+    };
+
+    if ((table->pointers == NULL) || (table->segments == NULL))
+    {
+        port_memory_table_destroy(table);
+        return NULL;
+    }
+
+    return table;
+}
+
+void
+port_memory_table_destroy(
+        port_memory_table_t *table)
+{
+    if (table == NULL)
+        return;
+
+    if (table->segments != NULL)
+        for (port_uint32_t i = 0; i < table->num_segments; i++)
+            if (table->segments[i].mapping != NULL)
+                munmap(table->segments[i].mapping, table->segments[i].mapping_size);
+
+    free(table->pointers);
+    free(table->segments);
+    free(table);
+}
+
+port_void_ptr_t
+port_memory_table_alloc_segment(
+        port_memory_table_t *table,
+        port_memory_segment_params_t params,
+
+        port_uint32_t *tidx)
+{
+    if ((table == NULL) || (table->num_segments == table->capacity) ||
+            (params.num_bytes == 0) || (params.num_bytes > table->max_segment_size))
+        return NULL;
+
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t align = page_size;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    switch (params.pages)
+    {
+        case PORT_MEMORY_PAGES_DEFAULT:
+            break;
+
+        case PORT_MEMORY_PAGES_TRANSPARENT_HUGE:
+            align = huge_page_size();
+            break;
+
+        case PORT_MEMORY_PAGES_HUGETLB:
+#ifdef MAP_HUGETLB
+            align = huge_page_size();
+            flags |= MAP_HUGETLB;
+            break;
+#else
+            return NULL;
+#endif
+
+        default:
+            return NULL;
+    }
+
+    size_t size = ROUND_UP(params.num_bytes, align);
+
+    // transparent huge pages need huge page aligned memory, so map extra space for alignment
+    size_t mapping_size = (params.pages == PORT_MEMORY_PAGES_TRANSPARENT_HUGE) ? size + align : size;
+
+    char *mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (mapping == MAP_FAILED)
+        return NULL;
+
+    char *memory = mapping;
+
+    if (params.pages == PORT_MEMORY_PAGES_TRANSPARENT_HUGE)
+    {
+        memory = (char*)ROUND_UP((uintptr_t)mapping, align);
+
+        if (memory > mapping)
+            munmap(mapping, memory - mapping);
+        if (mapping + mapping_size > memory + size)
+            munmap(memory + size, (mapping + mapping_size) - (memory + size));
+
+        mapping = memory;
+        mapping_size = size;
+
+#ifdef MADV_HUGEPAGE
+        madvise(memory, size, MADV_HUGEPAGE); // advisory, failure is not an error
+#endif
+    }
+
+    if ((params.numa_node >= 0) && !bind_to_numa_node(memory, size, params.numa_node))
+    {
+        munmap(mapping, mapping_size);
+        return NULL;
+    }
+
+    // prefault pages after binding, so that they are allocated on the right node
+    if (params.populate)
+    {
+        size_t step = (params.pages == PORT_MEMORY_PAGES_DEFAULT) ? page_size : align;
+        for (size_t offset = 0; offset < size; offset += step)
+            ((volatile char*)memory)[offset] = 0;
+    }
+
+    port_memory_segment_t segment = {
+        .memory = memory, .num_bytes = params.num_bytes,
+        .mapping = mapping, .mapping_size = mapping_size,
+    };
+
+    if (!add_segment(table, segment, tidx))
+    {
+        munmap(mapping, mapping_size);
+        return NULL;
+    }
+
+    return memory;
+}
+
+bool
+port_memory_table_add_segment(
+        port_memory_table_t *table,
+        port_void_ptr_t memory,
+        size_t num_bytes,
+
+        port_uint32_t *tidx)
+{
+    if ((table == NULL) || (memory == NULL) || (num_bytes > table->max_segment_size))
+        return false;
+
+    port_memory_segment_t segment = {.memory = memory, .num_bytes = num_bytes};
+    return add_segment(table, segment, tidx);
+}
+
+#endif // __OPENCL_C_VERSION__
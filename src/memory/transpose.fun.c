@@ -0,0 +1,320 @@
+/****************************************************************************
+ * Copyright (C) 2020-2026 by Ivan Podmazov                                 *
+ *                                                                          *
+ * This file is part of Port.                                               *
+ *                                                                          *
+ *   Port is free software: you can redistribute it and/or modify it        *
+ *   under the terms of the GNU Lesser General Public License as published  *
+ *   by the Free Software Foundation, either version 3 of the License, or   *
+ *   (at your option) any later version.                                    *
+ *                                                                          *
+ *   Port is distributed in the hope that it will be useful,                *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Port. If not, see <http://www.gnu.org/licenses/>.   *
+ ****************************************************************************/
+
+/**
+ * @file
+ * @brief Kernels for transposition of record arrays between AoS and SoA layouts.
+ */
+
+#include "port/memory/transpose.fun.h"
+
+#define TILE PORT_MEMORY_TRANSPOSE_TILE_SIZE
+
+#ifdef __OPENCL_C_VERSION__
+
+/*
+ * A tile of records is gathered into a private array,
+ * then written out with vector stores (vstore4 matches the tile size).
+ */
+#define DEFINE_TRANSPOSE_KERNELS(type, num_fields, simd) \
+PORT_KERNEL port_memory_transpose_aos_to_soa_##type##_x##num_fields(                         \
+        port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records \
+        PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0))                                                   \
+{                                                                                               \
+    const port_work_item_index_t idx = PORT_WORK_ITEM_INDEX(0);                                 \
+    port_##type##_t tile[TILE * num_fields];                                                    \
+                                                                                                \
+    for (unsigned k = 0; k < TILE; k++)                                                         \
+        vstore##num_fields(vload##num_fields(TILE * idx + k,                                    \
+                    (const __global port_##type##_t*)aos), k, tile);                            \
+                                                                                                \
+    for (unsigned f = 0; f < num_fields; f++)                                                   \
+        vstore4((port_##type##_v4_t)(tile[f], tile[num_fields + f],                             \
+                    tile[2 * num_fields + f], tile[3 * num_fields + f]),                        \
+                idx, (__global port_##type##_t*)soa + (size_t)f * num_records);                 \
+}                                                                                               \
+                                                                                                \
+PORT_KERNEL port_memory_transpose_soa_to_aos_##type##_x##num_fields(                         \
+        port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records \
+        PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0))                                                   \
+{                                                                                               \
+    const port_work_item_index_t idx = PORT_WORK_ITEM_INDEX(0);                                 \
+    port_##type##_t tile[TILE * num_fields];                                                    \
+                                                                                                \
+    for (unsigned f = 0; f < num_fields; f++)                                                   \
+    {                                                                                           \
+        port_##type##_v4_t column = vload4(idx,                                                 \
+                (const __global port_##type##_t*)soa + (size_t)f * num_records);                \
+        tile[f] = column.s0;                                                                    \
+        tile[num_fields + f] = column.s1;                                                       \
+        tile[2 * num_fields + f] = column.s2;                                                   \
+        tile[3 * num_fields + f] = column.s3;                                                   \
+    }                                                                                           \
+                                                                                                \
+    for (unsigned k = 0; k < TILE; k++)                                                         \
+        vstore##num_fields(vload##num_fields(k, tile), TILE * idx + k,                          \
+                (__global port_##type##_t*)aos);                                                \
+}
+
+#else // __OPENCL_C_VERSION__
+
+#include <stdbool.h>
+
+#if defined(__SSE2__)
+#  define SSE2_TRANSPOSE
+#  include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// SIMD helpers
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Helpers transpose a whole tile and return true,
+ * or return false if the number of fields is not supported,
+ * then the tile is transposed by the scalar loops.
+ * Number of fields is a constant, so the checks are folded.
+ */
+
+#define SIMD_NONE(op, ...) false
+
+#ifdef SSE2_TRANSPOSE
+
+#  define SIMD_32(op, ...) op##_32bit(__VA_ARGS__)
+#  define SIMD_64(op, ...) op##_64bit(__VA_ARGS__)
+
+#  define LOAD(ptr) _mm_loadu_si128((const __m128i*)(ptr))
+#  define STORE(ptr, v) _mm_storeu_si128((__m128i*)(ptr), (v))
+
+/*
+ * Transpose 4x4 block of 32-bit elements,
+ * strides are distances between rows in elements.
+ */
+static inline void
+transpose_4x4_32bit(
+        const port_uint32_t *restrict src,
+        size_t src_stride,
+        port_uint32_t *restrict dst,
+        size_t dst_stride)
+{
+    __m128i r0 = LOAD(src), r1 = LOAD(src + src_stride);
+    __m128i r2 = LOAD(src + 2 * src_stride), r3 = LOAD(src + 3 * src_stride);
+
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1); // 00 10 01 11
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3); // 20 30 21 31
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1); // 02 12 03 13
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3); // 22 32 23 33
+
+    STORE(dst, _mm_unpacklo_epi64(t0, t1));
+    STORE(dst + dst_stride, _mm_unpackhi_epi64(t0, t1));
+    STORE(dst + 2 * dst_stride, _mm_unpacklo_epi64(t2, t3));
+    STORE(dst + 3 * dst_stride, _mm_unpackhi_epi64(t2, t3));
+}
+
+/*
+ * Transpose 2x2 block of 64-bit elements,
+ * strides are distances between rows in elements.
+ */
+static inline void
+transpose_2x2_64bit(
+        const port_uint64_t *restrict src,
+        size_t src_stride,
+        port_uint64_t *restrict dst,
+        size_t dst_stride)
+{
+    __m128i r0 = LOAD(src), r1 = LOAD(src + src_stride);
+
+    STORE(dst, _mm_unpacklo_epi64(r0, r1));
+    STORE(dst + dst_stride, _mm_unpackhi_epi64(r0, r1));
+}
+
+static inline bool
+aos_to_soa_32bit(
+        const void *restrict aos,
+        void *restrict soa,
+        unsigned num_fields,
+        size_t num_records)
+{
+    const port_uint32_t *src = aos;
+    port_uint32_t *dst = soa;
+
+    if (num_fields == 2)
+    {
+        __m128i a = _mm_shuffle_epi32(LOAD(src), _MM_SHUFFLE(3, 1, 2, 0));     // 00 10 01 11
+        __m128i b = _mm_shuffle_epi32(LOAD(src + 4), _MM_SHUFFLE(3, 1, 2, 0)); // 20 30 21 31
+
+        STORE(dst, _mm_unpacklo_epi64(a, b));
+        STORE(dst + num_records, _mm_unpackhi_epi64(a, b));
+    }
+    else if (num_fields % 4 == 0)
+    {
+        for (unsigned f = 0; f < num_fields; f += 4)
+            transpose_4x4_32bit(src + f, num_fields, dst + f * num_records, num_records);
+    }
+    else
+        return false;
+
+    return true;
+}
+
+static inline bool
+soa_to_aos_32bit(
+        const void *restrict soa,
+        void *restrict aos,
+        unsigned num_fields,
+        size_t num_records)
+{
+    const port_uint32_t *src = soa;
+    port_uint32_t *dst = aos;
+
+    if (num_fields == 2)
+    {
+        __m128i f0 = LOAD(src), f1 = LOAD(src + num_records);
+
+        STORE(dst, _mm_unpacklo_epi32(f0, f1));
+        STORE(dst + 4, _mm_unpackhi_epi32(f0, f1));
+    }
+    else if (num_fields % 4 == 0)
+    {
+        for (unsigned f = 0; f < num_fields; f += 4)
+            transpose_4x4_32bit(src + f * num_records, num_records, dst + f, num_fields);
+    }
+    else
+        return false;
+
+    return true;
+}
+
+static inline bool
+aos_to_soa_64bit(
+        const void *restrict aos,
+        void *restrict soa,
+        unsigned num_fields,
+        size_t num_records)
+{
+    const port_uint64_t *src = aos;
+    port_uint64_t *dst = soa;
+
+    if (num_fields % 2 != 0)
+        return false;
+
+    for (unsigned k = 0; k < TILE; k += 2)
+        for (unsigned f = 0; f < num_fields; f += 2)
+            transpose_2x2_64bit(src + k * num_fields + f, num_fields, dst + f * num_records + k, num_records);
+
+    return true;
+}
+
+static inline bool
+soa_to_aos_64bit(
+        const void *restrict soa,
+        void *restrict aos,
+        unsigned num_fields,
+        size_t num_records)
+{
+    const port_uint64_t *src = soa;
+    port_uint64_t *dst = aos;
+
+    if (num_fields % 2 != 0)
+        return false;
+
+    for (unsigned k = 0; k < TILE; k += 2)
+        for (unsigned f = 0; f < num_fields; f += 2)
+            transpose_2x2_64bit(src + f * num_records + k, num_records, dst + k * num_fields + f, num_fields);
+
+    return true;
+}
+
+#  undef LOAD
+#  undef STORE
+
+#else // SSE2_TRANSPOSE
+
+#  define SIMD_32 SIMD_NONE
+#  define SIMD_64 SIMD_NONE
+
+#endif // SSE2_TRANSPOSE
+
+/*
+ * Records of 32-bit and 64-bit elements with 2, 4, 8 or 16 fields
+ * are transposed with SSE2 unpacks and shuffles where available.
+ * Other tiles are transposed by loops over restrict-qualified pointers.
+ */
+#define DEFINE_TRANSPOSE_KERNELS(type, num_fields, simd) \
+PORT_KERNEL port_memory_transpose_aos_to_soa_##type##_x##num_fields(                         \
+        port_const_global_void_ptr_t aos, port_global_void_ptr_t soa, port_uint32_t num_records \
+        PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0))                                                   \
+{                                                                                               \
+    const port_work_item_index_t idx = PORT_WORK_ITEM_INDEX(0);                                 \
+    const port_##type##_t *restrict src = (const port_##type##_t*)aos + TILE * idx * num_fields; \
+    port_##type##_t *restrict dst = (port_##type##_t*)soa + TILE * idx;                         \
+                                                                                                \
+    if (simd(aos_to_soa, src, dst, num_fields, num_records))                                   \
+        return;                                                                                 \
+                                                                                                \
+    for (unsigned f = 0; f < num_fields; f++)                                                   \
+        for (unsigned k = 0; k < TILE; k++)                                                     \
+            dst[(size_t)f * num_records + k] = src[k * num_fields + f];                         \
+}                                                                                               \
+                                                                                                \
+PORT_KERNEL port_memory_transpose_soa_to_aos_##type##_x##num_fields(                         \
+        port_const_global_void_ptr_t soa, port_global_void_ptr_t aos, port_uint32_t num_records \
+        PORT_KERNEL_PARAM_WORK_ITEM_INDEX(0))                                                   \
+{                                                                                               \
+    const port_work_item_index_t idx = PORT_WORK_ITEM_INDEX(0);                                 \
+    const port_##type##_t *restrict src = (const port_##type##_t*)soa + TILE * idx;             \
+    port_##type##_t *restrict dst = (port_##type##_t*)aos + TILE * idx * num_fields;            \
+                                                                                                \
+    if (simd(soa_to_aos, src, dst, num_fields, num_records))                                   \
+        return;                                                                                 \
+                                                                                                \
+    for (unsigned k = 0; k < TILE; k++)                                                         \
+        for (unsigned f = 0; f < num_fields; f++)                                               \
+            dst[k * num_fields + f] = src[(size_t)f * num_records + k];                         \
+}
+
+#endif // __OPENCL_C_VERSION__
+
+#define DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(type, simd) \
+    DEFINE_TRANSPOSE_KERNELS(type, 2, simd)     \
+    DEFINE_TRANSPOSE_KERNELS(type, 3, simd)     \
+    DEFINE_TRANSPOSE_KERNELS(type, 4, simd)     \
+    DEFINE_TRANSPOSE_KERNELS(type, 8, simd)     \
+    DEFINE_TRANSPOSE_KERNELS(type, 16, simd)
+
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(uint8, SIMD_NONE)
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(uint16, SIMD_NONE)
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(uint32, SIMD_32)
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(uint64, SIMD_64)
+
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(sint8, SIMD_NONE)
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(sint16, SIMD_NONE)
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(sint32, SIMD_32)
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(sint64, SIMD_64)
+
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(float32, SIMD_32)
+DEFINE_TRANSPOSE_KERNELS_FOR_TYPE(float64, SIMD_64)
+
+#undef DEFINE_TRANSPOSE_KERNELS_FOR_TYPE
+#undef DEFINE_TRANSPOSE_KERNELS
+
+#undef SIMD_NONE
+#undef SIMD_32
+#undef SIMD_64
+
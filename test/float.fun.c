@@ -6,6 +6,7 @@
 #include "port/vector.def.h"
 
 #include <tgmath.h>
+#include <stdlib.h>
 
 
 TEST(port_float32_clamp)
@@ -574,3 +575,68 @@ TEST(port_convert_float32_to_float16_v16)
     ASSERT_EQ(vector.sF, 0x0400, port_uint16_t, "%X");
 }
 
+
+TEST(port_convert_float16_array_to_float32)
+{
+#define NUM_VALUES (1 << 16)
+
+    port_uint16_t *halves = malloc(NUM_VALUES * sizeof(*halves));
+    port_float32_t *floats = malloc(NUM_VALUES * sizeof(*floats));
+    ASSERT_TRUE((halves != NULL) && (floats != NULL));
+
+    for (port_uint32_t i = 0; i < NUM_VALUES; i++)
+        halves[i] = i;
+
+    // odd size leaves a tail for the scalar loop
+    port_convert_float16_array_to_float32(floats, halves, NUM_VALUES - 3);
+
+    for (port_uint32_t i = 0; i < NUM_VALUES - 3; i++)
+    {
+        port_float32_t expected = port_convert_float16_to_float32(i);
+        if (isnan(expected))
+            ASSERT_TRUE(isnan(floats[i]));
+        else
+            ASSERT_EQ(floats[i], expected, port_float32_t, "%g");
+    }
+
+    for (port_uint32_t i = 0; i < NUM_VALUES; i++)
+        floats[i] = (port_float32_t)((int)i - NUM_VALUES / 2) * 1.37f;
+    floats[0] = PORT_M_INFINITY;
+    floats[1] = PORT_M_NAN;
+    floats[2] = 1e-9f;
+    floats[3] = 65519.99609375f;
+
+    port_convert_float32_array_to_float16(halves, floats, NUM_VALUES - 5);
+
+    for (port_uint32_t i = 0; i < NUM_VALUES - 5; i++)
+        ASSERT_EQ(halves[i], port_convert_float32_to_float16(floats[i]), port_uint16_t, "%X");
+
+    free(floats);
+    free(halves);
+
+#undef NUM_VALUES
+}
+
+TEST(port_convert_float16_to_float32_exhaustive)
+{
+#ifdef __GNUC__
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wpedantic"
+    for (port_uint32_t i = 0; i < (1 << 16); i++)
+    {
+        union {
+            port_uint32_t as_uint;
+            port_float32_t as_float;
+        } u = {.as_float = port_convert_float16_to_float32(i)}, expected;
+
+        union {
+            port_uint16_t as_uint;
+            _Float16 as_float;
+        } h = {.as_uint = i};
+        expected.as_float = (port_float32_t)h.as_float;
+
+        ASSERT_EQ(u.as_uint, expected.as_uint, port_uint32_t, "%X");
+    }
+#  pragma GCC diagnostic pop
+#endif
+}
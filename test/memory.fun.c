@@ -2,8 +2,21 @@
 
 #include "port/memory.fun.h"
 #include "port/memory/copy.fun.h"
+#include "port/memory/atomic.fun.h"
 #include "port/memory/read.fun.h"
 #include "port/memory/write.fun.h"
+#include "port/memory/gather.fun.h"
+#include "port/memory/table.fun.h"
+#include "port/memory/relocate.fun.h"
+#include "port/memory/image.fun.h"
+#include "port/memory/profile.fun.h"
+#include "port/memory/arena.fun.h"
+#include "port/memory/pool.fun.h"
+#include "port/memory/transpose.fun.h"
+#include "port/memory/dirty.fun.h"
+#include "port/memory/cow.fun.h"
+#include "port/memory/compress.fun.h"
+#include "port/memory/shard.fun.h"
 #include "port/memory/unit.typ.h"
 #include "port/memory.def.h"
 #include "port/constants.def.h"
@@ -11,6 +24,8 @@
 #include "port/vector.def.h"
 
 #include <tgmath.h>
+#include <stdlib.h>
+#include <stdio.h>
 
 
 TEST(PORT_MEMORY_REF_IS_FAR)
@@ -53,36 +68,244 @@ TEST(PORT_MEMORY_REF_FAR__OFFSET)
 
 TEST(port_memory_at)
 {
-    port_memory_unit_t unit0 = {0};
-    port_memory_unit_t unit1 = {0};
-    port_memory_unit_t unit2 = {0};
-    port_const_void_ptr_t memory_table[3] = {&unit0, &unit1, &unit2};
+    // resolved pointers must stay within the arrays
+    static port_memory_unit_t units[3][3000];
+    port_const_void_ptr_t memory_table[3] = {units[0], units[1], units[2]};
 
     port_memory_ref_t ref;
     const port_memory_unit_t *ptr;
 
     ref = -1;
-    ptr = port_memory_at(ref, (port_memory_ref_format_t){.near = {2}}, &unit2, memory_table);
-    ASSERT_EQ(ptr - &unit2, 1, ptrdiff_t, "%ti");
+    ptr = port_memory_at(ref, (port_memory_ref_format_t){.near = {2}}, units[2], memory_table);
+    ASSERT_EQ(ptr - units[2], 1, ptrdiff_t, "%ti");
 
     ref = -10;
     ptr = port_memory_at(ref, (port_memory_ref_format_t){.near = {2}}, NULL, memory_table);
-    ASSERT_EQ(ptr - &unit0, 10, ptrdiff_t, "%ti");
+    ASSERT_EQ(ptr - units[0], 10, ptrdiff_t, "%ti");
 
     port_uint8_t num_idx_bits = 2;
     port_uint8_t offset_shift = 8;
 
     ref = PORT_MEMORY_REF_FAR(port_memory_ref_t, num_idx_bits, 0, 0);
     ptr = port_memory_at(ref, (port_memory_ref_format_t){.far = {num_idx_bits, offset_shift + 2}}, NULL, memory_table);
-    ASSERT_EQ(ptr - &unit0, 0, ptrdiff_t, "%ti");
+    ASSERT_EQ(ptr - units[0], 0, ptrdiff_t, "%ti");
 
     ref = PORT_MEMORY_REF_FAR(port_memory_ref_t, num_idx_bits, 1, 10);
     ptr = port_memory_at(ref, (port_memory_ref_format_t){.far = {num_idx_bits, offset_shift + 2}}, NULL, memory_table + 1);
-    ASSERT_EQ(ptr - &unit2, 10 << offset_shift, ptrdiff_t, "%ti");
+    ASSERT_EQ(ptr - units[2], 10 << offset_shift, ptrdiff_t, "%ti");
 
     ref = PORT_MEMORY_REF_FAR(port_memory_ref_t, num_idx_bits, 0, 5);
     ptr = port_memory_at(ref, (port_memory_ref_format_t){.far = {num_idx_bits, offset_shift + 2}}, NULL, memory_table + 2);
-    ASSERT_EQ(ptr - &unit2, 5 << offset_shift, ptrdiff_t, "%ti");
+    ASSERT_EQ(ptr - units[2], 5 << offset_shift, ptrdiff_t, "%ti");
+}
+
+TEST(port_memory_ref_decode_v16)
+{
+    port_memory_ref_format_t format = {.far = {3, 4}, .near = {2}};
+
+    port_sint32_v16_t refs;
+    for (int i = 0; i < 16; i++)
+        refs.s[i] = (i % 3 == 0) ? -(i * 7 + 1) : PORT_MEMORY_REF_FAR(port_memory_ref_t, 3, i % 8, i * 1000);
+
+    port_sint32_v16_t tidx;
+    port_uint32_v16_t offsets = port_memory_ref_decode_v16(refs, format, &tidx);
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (i % 3 == 0)
+        {
+            ASSERT_EQ(tidx.s[i], -1, port_sint32_t, "%i");
+            ASSERT_EQ(offsets.s[i], (i * 7 + 1) << 2, port_uint32_t, "%u");
+        }
+        else
+        {
+            ASSERT_EQ(tidx.s[i], PORT_MEMORY_REF_FAR__TABLE_INDEX(refs.s[i], 3), port_sint32_t, "%i");
+            ASSERT_EQ(offsets.s[i], PORT_MEMORY_REF_FAR__OFFSET(refs.s[i], 3) << 4, port_uint32_t, "%u");
+        }
+    }
+
+    port_sint32_v4_t refs4 = PORT_V4(-1, 0, 9, INT32_MIN);
+    port_sint32_v4_t tidx4;
+    port_uint32_v4_t offsets4 = port_memory_ref_decode_v4(refs4, format, &tidx4);
+
+    ASSERT_EQ(tidx4.s[0], -1, port_sint32_t, "%i");
+    ASSERT_EQ(offsets4.s[0], 4, port_uint32_t, "%u");
+    ASSERT_EQ(tidx4.s[1], 0, port_sint32_t, "%i");
+    ASSERT_EQ(offsets4.s[1], 0, port_uint32_t, "%u");
+    ASSERT_EQ(tidx4.s[2], 1, port_sint32_t, "%i");
+    ASSERT_EQ(offsets4.s[2], 1 << 4, port_uint32_t, "%u");
+    ASSERT_EQ(tidx4.s[3], -1, port_sint32_t, "%i");
+    ASSERT_EQ(offsets4.s[3], 0, port_uint32_t, "%u"); // 2^31 << 2 modulo 2^32
+}
+
+TEST(port_memory_at_half)
+{
+    port_memory_unit_t units[3][16] = {0};
+    port_const_void_ptr_t memory_table[3] = {units[0], units[1], units[2]};
+
+    port_memory_ref_format_t format = {.far = {2, 2}, .near = {2}};
+    const port_memory_unit_t *ptr;
+
+    ptr = port_memory_at_half(-3, format, units[2], memory_table);
+    ASSERT_EQ(ptr - units[2], 3, ptrdiff_t, "%ti");
+
+    ptr = port_memory_at_half(PORT_MEMORY_REF_FAR(port_memory_ref_half_t, 2, 1, 7), format, NULL, memory_table);
+    ASSERT_EQ(ptr - units[1], 7, ptrdiff_t, "%ti");
+
+    port_memory_unit_t unit;
+    unit.PORT_MEMORY_UNIT__AS_REF_HALF[0] = -5;
+    unit.PORT_MEMORY_UNIT__AS_REF_HALF[1] = PORT_MEMORY_REF_FAR(port_memory_ref_half_t, 2, 2, 9);
+
+    port_const_void_ptr_t ptrs[2];
+    port_memory_at_unit_half(unit, format, NULL, memory_table, ptrs);
+    ASSERT_EQ((const port_memory_unit_t*)ptrs[0] - units[0], 5, ptrdiff_t, "%ti");
+    ASSERT_EQ((const port_memory_unit_t*)ptrs[1] - units[2], 9, ptrdiff_t, "%ti");
+}
+
+TEST(port_memory_at_quarter)
+{
+    port_memory_unit_t units[2][16] = {0};
+    port_const_void_ptr_t memory_table[2] = {units[0], units[1]};
+
+    port_memory_ref_format_t format = {.far = {1, 2}, .near = {2}};
+    const port_memory_unit_t *ptr;
+
+    ptr = port_memory_at_quarter(-1, format, units[1], memory_table);
+    ASSERT_EQ(ptr - units[1], 1, ptrdiff_t, "%ti");
+
+    ptr = port_memory_at_quarter(PORT_MEMORY_REF_FAR(port_memory_ref_quarter_t, 1, 1, 15), format, NULL, memory_table);
+    ASSERT_EQ(ptr - units[1], 15, ptrdiff_t, "%ti");
+
+    port_memory_unit_t unit;
+    unit.PORT_MEMORY_UNIT__AS_REF_QUARTER[0] = PORT_MEMORY_REF_FAR(port_memory_ref_quarter_t, 1, 0, 4);
+    unit.PORT_MEMORY_UNIT__AS_REF_QUARTER[1] = -2;
+    unit.PORT_MEMORY_UNIT__AS_REF_QUARTER[2] = PORT_MEMORY_REF_FAR(port_memory_ref_quarter_t, 1, 1, 0);
+    unit.PORT_MEMORY_UNIT__AS_REF_QUARTER[3] = -12;
+
+    port_const_void_ptr_t ptrs[4];
+    port_memory_at_unit_quarter(unit, format, units[1], memory_table, ptrs);
+    ASSERT_EQ((const port_memory_unit_t*)ptrs[0] - units[0], 4, ptrdiff_t, "%ti");
+    ASSERT_EQ((const port_memory_unit_t*)ptrs[1] - units[1], 2, ptrdiff_t, "%ti");
+    ASSERT_EQ((const port_memory_unit_t*)ptrs[2] - units[1], 0, ptrdiff_t, "%ti");
+    ASSERT_EQ((const port_memory_unit_t*)ptrs[3] - units[1], 12, ptrdiff_t, "%ti");
+}
+
+PORT_MEMORY_DEFINE_FORMAT(test, 2, 10, 2)
+
+TEST(PORT_MEMORY_DEFINE_FORMAT)
+{
+    port_memory_ref_format_t format = port_memory_format_test();
+    ASSERT_EQ(format.far.num_tidx_bits, 2, port_uint8_t, "%hhu");
+    ASSERT_EQ(format.far.offset_lshift, 10, port_uint8_t, "%hhu");
+    ASSERT_EQ(format.near.offset_lshift, 2, port_uint8_t, "%hhu");
+
+    port_memory_unit_t units[3] = {0};
+    port_const_void_ptr_t memory_table[3] = {&units[0], &units[1], &units[2]};
+
+    port_memory_ref_t refs[4] = {-1, -10, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 1, 10),
+        PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 2, 5)};
+
+    for (port_uint8_t i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(port_memory_at_test(refs[i], NULL, memory_table) ==
+                port_memory_at(refs[i], format, NULL, memory_table));
+        ASSERT_TRUE(port_memory_at_test_global(refs[i], &units[2], memory_table) ==
+                port_memory_at(refs[i], format, &units[2], memory_table));
+    }
+}
+
+TEST(port_memory_at_batch)
+{
+    port_memory_unit_t units[4][64] = {0};
+    port_const_void_ptr_t memory_table[4] = {units[0], units[1], units[2], units[3]};
+
+    port_memory_ref_format_t format = {.far = {2, 2}, .near = {2}};
+
+    port_memory_ref_t refs[11] = {
+        -1, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 3, 7), -63, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 1, 0),
+        PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 2, 63), -5, -20, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 0, 1),
+        PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 3, 0), -2, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 1, 42),
+    };
+
+    port_const_void_ptr_t ptrs[11];
+
+    port_memory_at_batch(refs, 11, format, NULL, memory_table, ptrs);
+    for (port_uint8_t i = 0; i < 11; i++)
+        ASSERT_TRUE(ptrs[i] == port_memory_at(refs[i], format, NULL, memory_table));
+
+    port_memory_at_batch(refs, 11, format, units[2], memory_table, ptrs);
+    for (port_uint8_t i = 0; i < 11; i++)
+        ASSERT_TRUE(ptrs[i] == port_memory_at(refs[i], format, units[2], memory_table));
+}
+
+TEST(port_memory_offset_batch)
+{
+    size_t offset_table[4] = {0, 1000, 2000, 3000};
+
+    port_memory_ref_format_t format = {.far = {2, 3}, .near = {2}};
+
+    port_memory_ref_t refs[6] = {
+        PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 1, 5), -3, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 3, 0),
+        -1, -100, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 2, 7),
+    };
+
+    size_t offsets[6];
+    port_memory_offset_batch(refs, 6, format, 500, offset_table, offsets);
+
+    ASSERT_EQ(offsets[0], 1000 + (5 << 3), size_t, "%zu");
+    ASSERT_EQ(offsets[1], 500 + (3 << 2), size_t, "%zu");
+    ASSERT_EQ(offsets[2], 3000, size_t, "%zu");
+    ASSERT_EQ(offsets[3], 500 + (1 << 2), size_t, "%zu");
+    ASSERT_EQ(offsets[4], 500 + (100 << 2), size_t, "%zu");
+    ASSERT_EQ(offsets[5], 2000 + (7 << 3), size_t, "%zu");
+}
+
+TEST(port_memory_follow_chain)
+{
+    port_memory_unit_t units[2][16] = {0};
+    port_const_void_ptr_t memory_table[2] = {units[0], units[1]};
+
+    port_memory_ref_format_t format = {.far = {1, 2}, .near = {2}};
+
+    // chain: units[0][0] -> units[0][4] -> units[1][2] -> units[1][10]
+    units[0][0 + 1].PORT_MEMORY_UNIT__AS_REF = -4;
+    units[0][4 + 1].PORT_MEMORY_UNIT__AS_REF = PORT_MEMORY_REF_FAR(port_memory_ref_t, 1, 1, 2);
+    units[1][2 + 1].PORT_MEMORY_UNIT__AS_REF = -8;
+
+    port_const_void_ptr_t nodes[4];
+    const port_memory_unit_t *ptr;
+
+    ptr = port_memory_follow_chain(PORT_MEMORY_REF_FAR(port_memory_ref_t, 1, 0, 0), format,
+            NULL, memory_table, 1, 3, nodes);
+    ASSERT_TRUE(ptr == &units[1][10]);
+    ASSERT_TRUE(nodes[0] == &units[0][0]);
+    ASSERT_TRUE(nodes[1] == &units[0][4]);
+    ASSERT_TRUE(nodes[2] == &units[1][2]);
+    ASSERT_TRUE(nodes[3] == &units[1][10]);
+
+    ptr = port_memory_follow_chain(-4, format, units[0], memory_table, 1, 1, NULL);
+    ASSERT_TRUE(ptr == &units[1][2]);
+}
+
+TEST(port_memory_prefetch_batch)
+{
+    port_memory_unit_t units[2][16] = {0};
+    port_const_void_ptr_t memory_table[2] = {units[0], units[1]};
+
+    port_memory_ref_format_t format = {.far = {1, 2}, .near = {2}};
+
+    port_memory_ref_t refs[] = {-4, PORT_MEMORY_REF_FAR(port_memory_ref_t, 1, 1, 2), -15};
+
+    // prefetches have no visible effect, so check only that targets are resolved safely
+    port_memory_prefetch_batch(refs, 3, format, units[0], memory_table);
+    port_memory_prefetch_batch(refs, 3, format, NULL, memory_table);
+    port_memory_prefetch_batch(NULL, 0, format, NULL, memory_table);
+
+    port_const_void_ptr_t ptrs[3];
+    port_memory_at_batch(refs, 3, format, units[0], memory_table, ptrs);
+    ASSERT_TRUE(ptrs[0] == &units[0][4]);
+    ASSERT_TRUE(ptrs[1] == &units[1][2]);
+    ASSERT_TRUE(ptrs[2] == &units[0][15]);
 }
 
 TEST(port_memory_copy)
@@ -103,6 +326,105 @@ TEST(port_memory_copy)
 #undef NUM_BITS
 }
 
+TEST(port_memory_atomic_single)
+{
+    port_memory_unit_t unit = {.as_uint_single = 5};
+
+    ASSERT_EQ(port_memory_atomic_load_uint_single(&unit), 5, port_uint32_t, "%u");
+    port_memory_atomic_store_uint_single(&unit, 10);
+    ASSERT_EQ(port_memory_atomic_exchange_uint_single(&unit, 20), 10, port_uint32_t, "%u");
+    ASSERT_EQ(port_memory_atomic_fetch_add_uint_single(&unit, 3), 20, port_uint32_t, "%u");
+    ASSERT_EQ(port_memory_atomic_fetch_or_uint_single(&unit, 0x100), 23, port_uint32_t, "%u");
+    ASSERT_EQ(unit.as_uint_single, 0x117, port_uint32_t, "%X");
+
+    port_uint_single_t expected = 0;
+    ASSERT_FALSE(port_memory_atomic_cas_uint_single(&unit, &expected, 1));
+    ASSERT_EQ(expected, 0x117, port_uint32_t, "%X");
+    ASSERT_TRUE(port_memory_atomic_cas_uint_single(&unit, &expected, 1));
+    ASSERT_EQ(unit.as_uint_single, 1, port_uint32_t, "%u");
+
+    ASSERT_EQ(port_memory_atomic_max_uint_single(&unit, 0xFFFFFFFF), 1, port_uint32_t, "%u");
+    ASSERT_EQ(port_memory_atomic_min_uint_single(&unit, 7), 0xFFFFFFFF, port_uint32_t, "%X");
+    ASSERT_EQ(unit.as_uint_single, 7, port_uint32_t, "%u");
+
+    // signed comparison
+    ASSERT_EQ(port_memory_atomic_min_sint_single(&unit, -1), 7, port_sint32_t, "%i");
+    ASSERT_EQ(port_memory_atomic_max_sint_single(&unit, -5), -1, port_sint32_t, "%i");
+    ASSERT_EQ(port_memory_atomic_fetch_add_sint_single(&unit, -2), -1, port_sint32_t, "%i");
+    ASSERT_EQ(unit.as_sint_single, -3, port_sint32_t, "%i");
+}
+
+TEST(port_memory_atomic_double)
+{
+    port_memory_unit_double_t unit = {.as_uint_double = 0x100000000};
+
+    ASSERT_EQ(port_memory_atomic_fetch_add_uint_double(&unit, 1), 0x100000000, port_uint64_t, "%lX");
+    ASSERT_EQ(port_memory_atomic_load_uint_double(&unit), 0x100000001, port_uint64_t, "%lX");
+    ASSERT_EQ(port_memory_atomic_max_uint_double(&unit, 0x200000000), 0x100000001, port_uint64_t, "%lX");
+    ASSERT_EQ(port_memory_atomic_min_sint_double(&unit, -1), 0x200000000, port_sint64_t, "%li");
+
+    port_sint_double_t expected = -1;
+    ASSERT_TRUE(port_memory_atomic_cas_sint_double(&unit, &expected, 42));
+    ASSERT_EQ(port_memory_atomic_exchange_sint_double(&unit, 0), 42, port_sint64_t, "%li");
+    ASSERT_EQ(unit.as_sint_double, 0, port_sint64_t, "%li");
+}
+
+TEST(port_memory_atomic_global)
+{
+    // named address space variants are aliases of generic functions on CPU
+    port_memory_unit_t unit = {.as_uint_single = 1};
+    port_memory_unit_double_t unit_double = {.as_sint_double = -1};
+
+    ASSERT_EQ(port_memory_atomic_fetch_add_global_uint_single(&unit, 2), 1, port_uint32_t, "%u");
+    ASSERT_EQ(port_memory_atomic_load_local_uint_single(&unit), 3, port_uint32_t, "%u");
+
+    port_sint_double_t expected = -1;
+    ASSERT_TRUE(port_memory_atomic_cas_global_sint_double(&unit_double, &expected, 5));
+    ASSERT_EQ(port_memory_atomic_max_global_sint_double(&unit_double, 9), 5, port_sint64_t, "%li");
+    ASSERT_EQ(port_memory_atomic_load_global_sint_double(&unit_double), 9, port_sint64_t, "%li");
+}
+
+TEST(port_memory_copy_remap)
+{
+    port_memory_unit_t src_segment[32] = {0}, dest_segment[16] = {0};
+    port_memory_ref_format_t format = {.far = {2, 2}, .near = {2}};
+    const port_uint32_t tidx_map[4] = {0, 1, 2, 0};
+    const port_uint32_t ref_units[2] = {1, 2};
+
+    port_memory_ref_map_t map = {.num_units = 3, .num_refs = 2, .ref_units = ref_units};
+
+    // block of 2 nodes: src_segment[4..9] -> dest_segment[0..5]
+    src_segment[4].as_uint_single = 100;
+    src_segment[5].as_sint_single = PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 1, 7); // into block
+    src_segment[6].as_sint_single = -3; // into block (next node)
+    src_segment[7].as_uint_single = 200;
+    src_segment[8].as_sint_single = PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 3, 10); // other segment
+    src_segment[9].as_sint_single = -20; // out of block
+
+    port_memory_ref_remap_t remap = {.src_tidx = 1, .dest_tidx = 2,
+        .src_offset = 4 * sizeof(port_memory_unit_t), .dest_offset = 0, .tidx_map = tidx_map};
+
+    ASSERT_TRUE(port_memory_copy_remap(dest_segment, &src_segment[4], 2, map, format, remap));
+
+    ASSERT_EQ(dest_segment[0].as_uint_single, 100, port_uint32_t, "%u");
+    ASSERT_EQ(dest_segment[1].as_sint_single, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 2, 3), port_sint32_t, "%i");
+    ASSERT_EQ(dest_segment[2].as_sint_single, -3, port_sint32_t, "%i");
+    ASSERT_EQ(dest_segment[3].as_uint_single, 200, port_uint32_t, "%u");
+    ASSERT_EQ(dest_segment[4].as_sint_single, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 0, 10), port_sint32_t, "%i");
+    ASSERT_EQ(dest_segment[5].as_sint_single, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 1, 7 + 20), port_sint32_t, "%i");
+
+    // references resolve to the same nodes as in the source block
+    port_const_void_ptr_t memory_table[3] = {NULL, src_segment, dest_segment};
+    ASSERT_TRUE(port_memory_at(dest_segment[2].as_sint_single, format, &dest_segment[0], memory_table) ==
+            &dest_segment[3]);
+    ASSERT_TRUE(port_memory_at(dest_segment[5].as_sint_single, format, &dest_segment[3], memory_table) ==
+            &src_segment[27]);
+
+    // the next node is not copied, so near reference to it leaves the block
+    ASSERT_TRUE(port_memory_copy_remap(dest_segment, &src_segment[4], 1, map, format, remap));
+    ASSERT_EQ(dest_segment[2].as_sint_single, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 1, 7), port_sint32_t, "%i");
+}
+
 TEST(port_memory_read_uint8)
 {
     port_uint8_t memory[] = {0x00, 0x10, 0x55, 0x68, 0xAA, 0xBC, 0xED, 0xFF};
@@ -501,3 +823,741 @@ TEST(port_memory_write_float64_v2)
     }
 }
 
+TEST(port_memory_unaligned)
+{
+    port_uint8_t stream[64] = {0};
+
+    for (size_t offset = 1; offset < 8; offset += 3)
+    {
+        port_memory_write_uint32_unaligned(stream, offset, 0x12345678);
+        ASSERT_EQ(port_memory_read_uint32_unaligned(stream, offset), 0x12345678, port_uint32_t, "%X");
+
+        port_uint64_v3_t vector64 = {.s = {1, 0xFFFFFFFFFFFF, 3}};
+        stream[offset + 24] = 0xAB;
+        port_memory_write_uint64_v3_unaligned(stream, offset, vector64);
+        ASSERT_EQ(stream[offset + 24], 0xAB, port_uint8_t, "%X"); // 3-vectors take 3 elements
+        vector64 = port_memory_read_uint64_v3_unaligned(stream, offset);
+        ASSERT_EQ(vector64.s[0], 1, port_uint64_t, "%lu");
+        ASSERT_EQ(vector64.s[1], 0xFFFFFFFFFFFF, port_uint64_t, "%lX");
+        ASSERT_EQ(vector64.s[2], 3, port_uint64_t, "%lu");
+
+        port_float32_v4_t vector32 = {.s = {0.5f, -1.0f, 1e10f, PORT_M_INFINITY}};
+        port_memory_write_float32_v4_unaligned(stream, offset, vector32);
+        port_float32_v4_t result32 = port_memory_read_float32_v4_unaligned(stream, offset);
+        for (int i = 0; i < 4; i++)
+            ASSERT_EQ(result32.s[i], vector32.s[i], port_float32_t, "%g");
+
+        port_float32_v4_t vector16 = {.s = {0.5f, -1.0f, 65504.0f, 3.0f}};
+        port_memory_write_float16_v4_unaligned(stream, offset, vector16);
+        port_float32_v4_t result16 = port_memory_read_float16_v4_unaligned(stream, offset);
+        for (int i = 0; i < 4; i++)
+            ASSERT_EQ(result16.s[i], vector16.s[i], port_float32_t, "%g");
+    }
+}
+
+TEST(port_memory_transpose)
+{
+#define NUM_RECORDS (2 * PORT_MEMORY_TRANSPOSE_TILE_SIZE)
+
+    port_uint16_t aos[NUM_RECORDS * 3], soa[NUM_RECORDS * 3], aos2[NUM_RECORDS * 3];
+    for (int i = 0; i < NUM_RECORDS * 3; i++)
+        aos[i] = i;
+
+    for (size_t idx = 0; idx < NUM_RECORDS / PORT_MEMORY_TRANSPOSE_TILE_SIZE; idx++)
+        port_memory_transpose_aos_to_soa_uint16_x3(aos, soa, NUM_RECORDS, idx);
+
+    for (int i = 0; i < NUM_RECORDS; i++)
+        for (int f = 0; f < 3; f++)
+            ASSERT_EQ(soa[f * NUM_RECORDS + i], 3 * i + f, port_uint16_t, "%u");
+
+    for (size_t idx = 0; idx < NUM_RECORDS / PORT_MEMORY_TRANSPOSE_TILE_SIZE; idx++)
+        port_memory_transpose_soa_to_aos_uint16_x3(soa, aos2, NUM_RECORDS, idx);
+
+    for (int i = 0; i < NUM_RECORDS * 3; i++)
+        ASSERT_EQ(aos2[i], aos[i], port_uint16_t, "%u");
+
+    // types and numbers of fields with SIMD code paths
+#define TEST_TRANSPOSE(type, num_fields) do {                                           \
+    port_##type##_t aos[NUM_RECORDS * num_fields], soa[NUM_RECORDS * num_fields],      \
+        aos2[NUM_RECORDS * num_fields];                                                \
+    for (int i = 0; i < NUM_RECORDS * num_fields; i++)                                 \
+        aos[i] = i + 1;                                                                 \
+                                                                                        \
+    for (size_t idx = 0; idx < NUM_RECORDS / PORT_MEMORY_TRANSPOSE_TILE_SIZE; idx++)   \
+        port_memory_transpose_aos_to_soa_##type##_x##num_fields(aos, soa, NUM_RECORDS, idx); \
+                                                                                        \
+    for (int i = 0; i < NUM_RECORDS; i++)                                               \
+        for (int f = 0; f < num_fields; f++)                                            \
+            ASSERT_EQ((port_uint64_t)soa[f * NUM_RECORDS + i], num_fields * i + f + 1, port_uint64_t, "%lu"); \
+                                                                                        \
+    for (size_t idx = 0; idx < NUM_RECORDS / PORT_MEMORY_TRANSPOSE_TILE_SIZE; idx++)   \
+        port_memory_transpose_soa_to_aos_##type##_x##num_fields(soa, aos2, NUM_RECORDS, idx); \
+                                                                                        \
+    for (int i = 0; i < NUM_RECORDS * num_fields; i++)                                 \
+        ASSERT_EQ((port_uint64_t)aos2[i], (port_uint64_t)aos[i], port_uint64_t, "%lu"); \
+} while (0)
+
+    TEST_TRANSPOSE(uint32, 2);
+    TEST_TRANSPOSE(float32, 4);
+    TEST_TRANSPOSE(sint32, 8);
+    TEST_TRANSPOSE(float32, 16);
+
+    TEST_TRANSPOSE(uint64, 2);
+    TEST_TRANSPOSE(float64, 4);
+    TEST_TRANSPOSE(sint64, 8);
+    TEST_TRANSPOSE(uint64, 16);
+
+#undef TEST_TRANSPOSE
+#undef NUM_RECORDS
+}
+
+TEST(port_memory_table_format)
+{
+    port_memory_ref_format_t format;
+
+    ASSERT_TRUE(port_memory_table_format(1, 4, &format));
+    ASSERT_EQ(format.far.num_tidx_bits, 0, port_uint8_t, "%hhu");
+    ASSERT_EQ(format.far.offset_lshift, 2, port_uint8_t, "%hhu");
+    ASSERT_EQ(format.near.offset_lshift, 2, port_uint8_t, "%hhu");
+
+    ASSERT_TRUE(port_memory_table_format(5, (size_t)1 << 30, &format));
+    ASSERT_EQ(format.far.num_tidx_bits, 3, port_uint8_t, "%hhu");
+    ASSERT_EQ(format.far.offset_lshift, 2, port_uint8_t, "%hhu");
+
+    ASSERT_TRUE(port_memory_table_format(256, (size_t)1 << 32, &format));
+    ASSERT_EQ(format.far.num_tidx_bits, 8, port_uint8_t, "%hhu");
+    ASSERT_EQ(format.far.offset_lshift, 9, port_uint8_t, "%hhu");
+
+    ASSERT_FALSE(port_memory_table_format(0, 4, &format));
+    ASSERT_FALSE(port_memory_table_format((port_uint32_t)1 << 31, 4, &format));
+}
+
+TEST(port_memory_table)
+{
+    port_memory_table_t *table = port_memory_table_create(4, 1 << 24);
+    ASSERT_TRUE(table != NULL);
+
+    port_uint32_t tidx;
+
+    port_memory_unit_t *segment0 = port_memory_table_alloc_segment(table,
+            (port_memory_segment_params_t){.num_bytes = 1 << 16, .numa_node = -1}, &tidx);
+    ASSERT_TRUE(segment0 != NULL);
+    ASSERT_EQ(tidx, 0, port_uint32_t, "%u");
+
+    port_memory_unit_t *segment1 = port_memory_table_alloc_segment(table,
+            (port_memory_segment_params_t){.num_bytes = 1 << 20, .numa_node = -1,
+            .pages = PORT_MEMORY_PAGES_TRANSPARENT_HUGE, .populate = true}, &tidx);
+    ASSERT_TRUE(segment1 != NULL);
+    ASSERT_EQ(tidx, 1, port_uint32_t, "%u");
+
+    port_memory_unit_t external[16];
+    ASSERT_TRUE(port_memory_table_add_segment(table, external, sizeof(external), &tidx));
+    ASSERT_EQ(tidx, 2, port_uint32_t, "%u");
+
+    ASSERT_TRUE(port_memory_table_alloc_segment(table,
+                (port_memory_segment_params_t){.num_bytes = 1 << 25, .numa_node = -1}, NULL) == NULL);
+
+    segment1[1000].as_uint_single = 42;
+
+    port_memory_ref_t ref = PORT_MEMORY_REF_FAR(port_memory_ref_t, table->format.far.num_tidx_bits, 1,
+            1000 >> (table->format.far.offset_lshift - 2));
+    const port_memory_unit_t *ptr = port_memory_at(ref, table->format, NULL, table->pointers);
+    ASSERT_TRUE(ptr == &segment1[1000]);
+    ASSERT_EQ(ptr->as_uint_single, 42, port_uint32_t, "%u");
+
+    ref = PORT_MEMORY_REF_FAR(port_memory_ref_t, table->format.far.num_tidx_bits, 2, 0);
+    ASSERT_TRUE(port_memory_at(ref, table->format, NULL, table->pointers) == external);
+
+    ASSERT_TRUE(port_memory_table_add_segment(table, external, sizeof(external), NULL));
+    ASSERT_FALSE(port_memory_table_add_segment(table, external, sizeof(external), NULL));
+
+    port_memory_table_destroy(table);
+}
+
+static bool
+test_node_map(const port_memory_unit_t *node, void *data, port_memory_ref_map_t *map)
+{
+    static const port_uint32_t ref_units[] = {1, 2, 3};
+    (void) data;
+
+    // node layout: number of references, references, payload
+    if (node[0].as_uint_single > 3)
+        return false;
+
+    *map = (port_memory_ref_map_t){.num_units = node[0].as_uint_single + 2,
+        .num_refs = node[0].as_uint_single, .ref_units = ref_units};
+    return true;
+}
+
+static port_uint32_t
+test_graph_checksum(const port_memory_unit_t *node, port_memory_ref_format_t format,
+        const port_const_void_ptr_t *memory_table, port_uint32_t depth)
+{
+    port_uint32_t num_refs = node[0].as_uint_single;
+    port_uint32_t sum = node[num_refs + 1].as_uint_single;
+
+    if (depth > 0)
+        for (port_uint32_t k = 0; k < num_refs; k++)
+            sum = sum * 31 + test_graph_checksum(port_memory_at(node[k + 1].PORT_MEMORY_UNIT__AS_REF,
+                        format, node, memory_table), format, memory_table, depth - 1);
+
+    return sum;
+}
+
+TEST(port_memory_dirty)
+{
+    port_memory_table_t *table = port_memory_table_create(2, 1 << 20);
+    ASSERT_TRUE(table != NULL);
+
+    port_memory_unit_t *segment = port_memory_table_alloc_segment(table,
+            (port_memory_segment_params_t){.num_bytes = 10000, .numa_node = -1}, NULL);
+    ASSERT_TRUE(port_memory_table_alloc_segment(table,
+                (port_memory_segment_params_t){.num_bytes = 4096, .numa_node = -1}, NULL) != NULL);
+
+    port_memory_dirty_t *dirty = port_memory_dirty_create(table, 6); // 64-byte blocks
+    ASSERT_TRUE(dirty != NULL);
+
+    port_memory_dirty_mark(dirty, 0, 60 * 64 + 10, 8 * 64); // blocks 60..68, crosses bitmap word
+    port_memory_dirty_mark(dirty, 0, 69 * 64, 1); // coalesced with the previous range
+    ASSERT_TRUE(port_memory_dirty_mark_ptr(dirty, (char*)segment + 9999, 100)); // last block, clipped
+    ASSERT_FALSE(port_memory_dirty_mark_ptr(dirty, (char*)segment + 10000, 1));
+    port_memory_dirty_mark(dirty, 1, 0, 1);
+
+    size_t offset = 0, num_bytes;
+
+    ASSERT_TRUE(port_memory_dirty_next_range(dirty, 0, &offset, &num_bytes, false));
+    ASSERT_EQ(offset, 60 * 64, size_t, "%zu");
+    ASSERT_EQ(num_bytes, 10 * 64, size_t, "%zu");
+
+    offset += num_bytes;
+    ASSERT_TRUE(port_memory_dirty_next_range(dirty, 0, &offset, &num_bytes, true));
+    ASSERT_EQ(offset, 156 * 64, size_t, "%zu");
+    ASSERT_EQ(num_bytes, 10000 - 156 * 64, size_t, "%zu");
+
+    offset += num_bytes;
+    ASSERT_FALSE(port_memory_dirty_next_range(dirty, 0, &offset, &num_bytes, false));
+
+    offset = 0;
+    ASSERT_TRUE(port_memory_dirty_next_range(dirty, 0, &offset, &num_bytes, true));
+    ASSERT_EQ(offset, 60 * 64, size_t, "%zu");
+
+    offset = 0;
+    ASSERT_FALSE(port_memory_dirty_next_range(dirty, 0, &offset, &num_bytes, false));
+
+    offset = 0;
+    ASSERT_TRUE(port_memory_dirty_next_range(dirty, 1, &offset, &num_bytes, true));
+    ASSERT_EQ(num_bytes, 64, size_t, "%zu");
+
+    port_memory_dirty_destroy(dirty);
+    port_memory_table_destroy(table);
+}
+
+TEST(port_memory_cow)
+{
+    const size_t block_size = 4096;
+    size_t segment_sizes[2] = {3 * block_size + 100, block_size};
+
+    port_memory_cow_t *cow = port_memory_cow_create(2, segment_sizes, block_size);
+    ASSERT_TRUE(cow != NULL);
+
+    port_memory_cow_version_t *v1 = port_memory_cow_version_create(cow, NULL);
+    ASSERT_TRUE(v1 != NULL);
+
+    port_memory_unit_t *units = (port_memory_unit_t*)v1->pointers[0];
+    for (size_t i = 0; i < segment_sizes[0] / sizeof(port_memory_unit_t); i++)
+        units[i].as_uint_single = i;
+    ((port_memory_unit_t*)v1->pointers[1])[5].as_uint_single = 0xCAFE;
+
+    port_memory_cow_version_t *v2 = port_memory_cow_version_create(cow, v1);
+    ASSERT_TRUE(v2 != NULL);
+    ASSERT_EQ(((const port_memory_unit_t*)v2->pointers[0])[2000].as_uint_single, 2000, port_uint32_t, "%u");
+
+    port_memory_unit_t *range = port_memory_cow_write(v2, 0, block_size + 8, 2 * sizeof(port_memory_unit_t));
+    ASSERT_TRUE(range != NULL);
+    range[0].as_uint_single = 0xDEAD;
+
+    ASSERT_EQ(((const port_memory_unit_t*)v2->pointers[0])[block_size / 4 + 2].as_uint_single,
+            0xDEAD, port_uint32_t, "%X");
+    ASSERT_EQ(((const port_memory_unit_t*)v1->pointers[0])[block_size / 4 + 2].as_uint_single,
+            block_size / 4 + 2, port_uint32_t, "%u");
+    ASSERT_EQ(((const port_memory_unit_t*)v2->pointers[0])[block_size / 4 + 3].as_uint_single,
+            block_size / 4 + 3, port_uint32_t, "%u");
+
+    // only the written block is copied
+    ASSERT_TRUE(v1->blocks[0][0] == v2->blocks[0][0]);
+    ASSERT_TRUE(v1->blocks[0][1] != v2->blocks[0][1]);
+
+    port_memory_ref_format_t format = {.far = {1, 2}, .near = {2}};
+    const port_memory_unit_t *ptr = port_memory_at(PORT_MEMORY_REF_FAR(port_memory_ref_t, 1, 1, 5),
+            format, NULL, v2->pointers);
+    ASSERT_EQ(ptr->as_uint_single, 0xCAFE, port_uint32_t, "%X");
+
+    // block is not shared anymore, so it is not copied
+    port_memory_cow_version_destroy(v1);
+    size_t block = v2->blocks[0][0];
+    ASSERT_TRUE(port_memory_cow_write(v2, 0, 0, 1) != NULL);
+    ASSERT_TRUE(v2->blocks[0][0] == block);
+
+    // adjacent shared blocks are copied into consecutive file blocks
+    port_memory_cow_version_t *v3 = port_memory_cow_version_create(cow, v2);
+    ASSERT_TRUE(v3 != NULL);
+
+    units = port_memory_cow_write(v3, 0, 0, segment_sizes[0]);
+    ASSERT_TRUE(units != NULL);
+    units[0].as_uint_single = 0xBEEF;
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(v3->blocks[0][i] != v2->blocks[0][i]);
+        if (i > 0)
+            ASSERT_EQ(v3->blocks[0][i], v3->blocks[0][i - 1] + 1, size_t, "%zu");
+    }
+
+    ASSERT_EQ(units[block_size / 4 + 2].as_uint_single, 0xDEAD, port_uint32_t, "%X");
+    ASSERT_EQ(units[3 * block_size / 4 + 1].as_uint_single, 3 * block_size / 4 + 1, port_uint32_t, "%u");
+    ASSERT_EQ(((const port_memory_unit_t*)v2->pointers[0])[0].as_uint_single, 0, port_uint32_t, "%u");
+
+    port_memory_cow_version_destroy(v3);
+    port_memory_cow_version_destroy(v2);
+    port_memory_cow_destroy(cow);
+}
+
+TEST(port_memory_compress)
+{
+#define NUM_RECORDS 1000
+
+    port_memory_unit_t *units = malloc(NUM_RECORDS * 4 * sizeof(*units));
+    port_memory_unit_t *materialized = malloc(NUM_RECORDS * 4 * sizeof(*units));
+    ASSERT_TRUE((units != NULL) && (materialized != NULL));
+
+    for (int i = 0; i < NUM_RECORDS; i++)
+    {
+        units[4 * i + 0].as_uint_single = i % 100;
+        units[4 * i + 1].as_sint_single = PORT_MEMORY_REF_FAR(port_memory_ref_t, 4, 3, 4 * i);
+        units[4 * i + 2].as_sint_single = -(i % 7 + 1);
+        units[4 * i + 3].as_uint_single = 0xDEADBEEF;
+    }
+
+    const port_uint32_t ref_units[2] = {1, 2};
+    port_memory_ref_map_t map = {.num_units = 4, .num_refs = 2, .ref_units = ref_units};
+
+    port_memory_compressed_segment_t *segment = port_memory_compress_segment(units,
+            NUM_RECORDS * 4 * sizeof(*units), map, 99, 2);
+    ASSERT_TRUE(segment != NULL);
+    ASSERT_EQ(segment->block_units, 100, size_t, "%zu");
+    ASSERT_LT(segment->block_offsets[segment->num_blocks], NUM_RECORDS * 4 * sizeof(*units) / 2, size_t, "%zu");
+
+    ASSERT_TRUE(port_memory_compressed_materialize(segment, materialized));
+    for (int i = 0; i < NUM_RECORDS * 4; i++)
+        ASSERT_EQ(materialized[i].as_uint_single, units[i].as_uint_single, port_uint32_t, "%X");
+
+    for (int k = 0; k < 3; k++)
+        for (int i = NUM_RECORDS * 4 - 1; i >= 0; i -= 37)
+        {
+            const port_memory_unit_t *unit = port_memory_compressed_at(segment, i * sizeof(*units));
+            ASSERT_TRUE(unit != NULL);
+            ASSERT_EQ(unit->as_uint_single, units[i].as_uint_single, port_uint32_t, "%X");
+        }
+
+    ASSERT_TRUE(port_memory_compressed_at(segment, NUM_RECORDS * 4 * sizeof(*units)) == NULL);
+
+    port_memory_compressed_segment_destroy(segment);
+    free(materialized);
+    free(units);
+
+#undef NUM_RECORDS
+}
+
+TEST(port_memory_shards)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "port-test-shards-%p", (void*)name);
+
+    port_memory_shards_t *shard0 = port_memory_shards_create(name, 2, 0, 4, 4096);
+    port_memory_shards_t *shard1 = port_memory_shards_create(name, 2, 1, 4, 4096);
+    ASSERT_TRUE((shard0 != NULL) && (shard1 != NULL));
+    ASSERT_EQ(shard0->tidx_per_shard, 2, port_uint32_t, "%u");
+
+    ASSERT_EQ(port_memory_shards_owner(shard0, 1), 0, port_uint32_t, "%u");
+    ASSERT_EQ(port_memory_shards_owner(shard0, 2), 1, port_uint32_t, "%u");
+
+    port_uint8_t num_tidx_bits = shard0->table->format.far.num_tidx_bits;
+    ASSERT_EQ(port_memory_shards_ref_owner(shard0,
+                PORT_MEMORY_REF_FAR(port_memory_ref_t, num_tidx_bits, 3, 5), 0), 1, port_uint32_t, "%u");
+    ASSERT_EQ(port_memory_shards_ref_owner(shard0, -1, 2), 1, port_uint32_t, "%u");
+
+    // only segments of the own shard can be allocated
+    ASSERT_TRUE(port_memory_shards_alloc_segment(shard0, 2, 64) == NULL);
+
+    port_memory_unit_t *segment0 = port_memory_shards_alloc_segment(shard0, 1, 64);
+    port_memory_unit_t *segment1 = port_memory_shards_alloc_segment(shard1, 3, 128);
+    ASSERT_TRUE((segment0 != NULL) && (segment1 != NULL));
+    segment0[0].as_uint_single = 0xC0FFEE;
+    segment1[7].as_uint_single = 0xBEEF;
+
+    ASSERT_EQ(port_memory_shards_attach_all(shard0), 1, port_uint32_t, "%u");
+    ASSERT_EQ(port_memory_shards_attach_all(shard1), 1, port_uint32_t, "%u");
+    ASSERT_EQ(shard0->table->segments[3].num_bytes, 128, size_t, "%zu");
+
+    const port_memory_unit_t *remote = shard1->table->pointers[1];
+    ASSERT_EQ(remote[0].as_uint_single, 0xC0FFEE, port_uint32_t, "%X");
+
+    port_memory_ref_t ref = PORT_MEMORY_REF_FAR(port_memory_ref_t, num_tidx_bits, 3, 7);
+    const port_memory_unit_t *unit = port_memory_at(ref, shard0->table->format, NULL, shard0->table->pointers);
+    ASSERT_EQ(unit->as_uint_single, 0xBEEF, port_uint32_t, "%X");
+
+    // changes made by the owner are visible to other shards
+    segment1[7].as_uint_single = 0xFACE;
+    ASSERT_EQ(unit->as_uint_single, 0xFACE, port_uint32_t, "%X");
+
+    port_memory_shards_destroy(shard0, true);
+    port_memory_shards_destroy(shard1, true);
+}
+
+TEST(port_memory_gather)
+{
+#define NUM_ELEMENTS 100
+#define COUNT 37
+
+    port_uint32_t u32[NUM_ELEMENTS], u32_out[COUNT];
+    port_uint64_t u64[NUM_ELEMENTS], u64_out[COUNT];
+    port_float32_t f32[NUM_ELEMENTS], f32_out[COUNT];
+    port_uint8_t u8[NUM_ELEMENTS], u8_out[COUNT];
+    port_uint32_t indices[COUNT];
+
+    for (int i = 0; i < NUM_ELEMENTS; i++)
+    {
+        u32[i] = 0x10000000 + i;
+        u64[i] = 0x100000000 + i;
+        f32[i] = 0.5f * i;
+        u8[i] = 200 - i;
+    }
+    for (int i = 0; i < COUNT; i++)
+        indices[i] = (i * 7 + 3) % NUM_ELEMENTS;
+
+    port_memory_gather_uint32(u32, indices, COUNT, u32_out);
+    port_memory_gather_uint64(u64, indices, COUNT, u64_out);
+    port_memory_gather_float32(f32, indices, COUNT, f32_out);
+    port_memory_gather_uint8(u8, indices, COUNT, u8_out);
+    for (int i = 0; i < COUNT; i++)
+    {
+        ASSERT_EQ(u32_out[i], u32[indices[i]], port_uint32_t, "%X");
+        ASSERT_EQ(u64_out[i], u64[indices[i]], port_uint64_t, "%lX");
+        ASSERT_EQ(f32_out[i], f32[indices[i]], port_float32_t, "%g");
+        ASSERT_EQ(u8_out[i], u8[indices[i]], port_uint8_t, "%u");
+    }
+
+    port_memory_read_uint32_strided(u32, 5, 2, COUNT, u32_out);
+    port_memory_read_uint64_strided(u64, 1, 1, COUNT, u64_out);
+    port_memory_read_float32_strided(f32, 0, 3, 33, f32_out);
+    for (int i = 0; i < COUNT; i++)
+    {
+        ASSERT_EQ(u32_out[i], u32[5 + 2 * i], port_uint32_t, "%X");
+        ASSERT_EQ(u64_out[i], u64[1 + i], port_uint64_t, "%lX");
+        if (i < 33)
+            ASSERT_EQ(f32_out[i], f32[3 * i], port_float32_t, "%g");
+    }
+
+    // repeated indices keep the last stored value
+    for (int i = 0; i < COUNT; i++)
+    {
+        indices[i] = i % 20;
+        u32_out[i] = i;
+        u64_out[i] = i;
+    }
+    port_memory_scatter_uint32(u32, indices, COUNT, u32_out);
+    port_memory_scatter_uint64(u64, indices, COUNT, u64_out);
+    for (int i = 0; i < 20; i++)
+    {
+        port_uint32_t expected = (i < COUNT - 20) ? 20 + i : i;
+        ASSERT_EQ(u32[i], expected, port_uint32_t, "%u");
+        ASSERT_EQ(u64[i], expected, port_uint64_t, "%lu");
+    }
+    ASSERT_EQ(u32[20], 0x10000000 + 20, port_uint32_t, "%X");
+
+    port_memory_write_uint32_strided(u32, 21, 2, COUNT, u32_out);
+    port_memory_write_uint64_strided(u64, 21, 2, COUNT, u64_out);
+    for (int i = 0; i < COUNT; i++)
+    {
+        ASSERT_EQ(u32[21 + 2 * i], i, port_uint32_t, "%u");
+        ASSERT_EQ(u64[21 + 2 * i], i, port_uint64_t, "%lu");
+        ASSERT_EQ(u32[22 + 2 * i], 0x10000000 + 22 + 2 * i, port_uint32_t, "%X");
+    }
+
+#undef COUNT
+#undef NUM_ELEMENTS
+}
+
+TEST(port_memory_relocate)
+{
+    port_memory_unit_t segments[3][32] = {0};
+    port_const_void_ptr_t memory_table[4] = {segments[0], segments[1], segments[2], NULL};
+    port_memory_ref_format_t format = {.far = {2, 2}, .near = {2}};
+
+#define FAR(tidx, unit) PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, (tidx), (unit))
+
+    // root A (seg 0, unit 0): refs to B (seg 2, unit 4), C (near, seg 0, unit 10)
+    segments[0][0].as_uint_single = 2;
+    segments[0][1].as_sint_single = FAR(2, 4);
+    segments[0][2].as_sint_single = -10;
+    segments[0][3].as_uint_single = 100;
+    // B: refs to D (seg 1, unit 0), A (cycle)
+    segments[2][4].as_uint_single = 2;
+    segments[2][5].as_sint_single = FAR(1, 0);
+    segments[2][6].as_sint_single = FAR(0, 0);
+    segments[2][7].as_uint_single = 200;
+    // C: ref to D
+    segments[0][10].as_uint_single = 1;
+    segments[0][11].as_sint_single = FAR(1, 0);
+    segments[0][12].as_uint_single = 300;
+    // D: leaf
+    segments[1][0].as_uint_single = 0;
+    segments[1][1].as_uint_single = 400;
+
+#undef FAR
+
+    port_memory_ref_t root = PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 0, 0);
+    port_uint32_t checksum = test_graph_checksum(segments[0], format, memory_table, 4);
+
+    for (int order = PORT_MEMORY_RELOCATION_BFS; order <= PORT_MEMORY_RELOCATION_DFS; order++)
+    {
+        port_memory_relocation_params_t params = {.order = order,
+            .node_map_fn = test_node_map, .new_tidx = 3};
+
+        port_memory_ref_t new_root;
+        port_memory_relocation_t result;
+
+        ASSERT_TRUE(port_memory_relocate(&root, 1, format, NULL, memory_table, params, &new_root, &result));
+        ASSERT_EQ(result.num_nodes, 4, size_t, "%zu");
+        ASSERT_EQ(result.num_bytes, (4 + 4 + 3 + 2) * sizeof(port_memory_unit_t), size_t, "%zu");
+        ASSERT_EQ(result.num_near_refs + result.num_far_refs, 5, size_t, "%zu");
+        // BFS: B -> A, DFS: B -> A, C -> D
+        ASSERT_EQ(result.num_far_refs, order == PORT_MEMORY_RELOCATION_BFS ? 1 : 2, size_t, "%zu");
+
+        memory_table[3] = result.segment;
+
+        const port_memory_unit_t *new_root_ptr = port_memory_at(new_root, format, NULL, memory_table);
+        ASSERT_TRUE(new_root_ptr == result.segment);
+        ASSERT_EQ(test_graph_checksum(new_root_ptr, format, memory_table, 4), checksum, port_uint32_t, "%u");
+
+        // BFS order: A B C D, DFS order: A B D C
+        ASSERT_EQ(result.segment[4 + 3].as_uint_single, 200, port_uint32_t, "%u");
+        ASSERT_EQ(result.segment[8 + (order == PORT_MEMORY_RELOCATION_BFS ? 2 : 1)].as_uint_single,
+                order == PORT_MEMORY_RELOCATION_BFS ? 300 : 400, port_uint32_t, "%u");
+
+        free(result.segment);
+        memory_table[3] = NULL;
+    }
+}
+
+TEST(port_memory_arena)
+{
+    port_memory_unit_t segments[2][16];
+    port_const_void_ptr_t memory_table[2] = {segments[0], segments[1]};
+    port_memory_ref_format_t format = {.far = {1, 3}, .near = {2}};
+
+    port_memory_arena_t arena;
+    port_memory_arena_init(&arena, format);
+    ASSERT_TRUE(port_memory_arena_add_segment(&arena, segments[0], sizeof(segments[0]), 0));
+    ASSERT_TRUE(port_memory_arena_add_segment(&arena, segments[1], sizeof(segments[1]), 1));
+
+    port_const_void_ptr_t base = segments[0];
+    port_memory_ref_t ref;
+    port_void_ptr_t ptr;
+
+    // block at base cannot be referenced with near reference
+    ptr = port_memory_arena_alloc(&arena, 3, base, &ref);
+    ASSERT_TRUE(ptr == &segments[0][0]);
+    ASSERT_TRUE(PORT_MEMORY_REF_IS_FAR(ref));
+    ASSERT_TRUE(port_memory_at(ref, format, base, memory_table) == ptr);
+
+    ptr = port_memory_arena_alloc(&arena, 2, base, &ref);
+    ASSERT_TRUE(ptr == &segments[0][3]);
+    ASSERT_EQ(ref, -3, port_memory_ref_t, "%i");
+    ASSERT_TRUE(port_memory_at(ref, format, base, memory_table) == ptr);
+
+    // far reference requires alignment to 2 units
+    ptr = port_memory_arena_alloc(&arena, 3, NULL, &ref);
+    ASSERT_TRUE(ptr == &segments[0][6]);
+    ASSERT_TRUE(PORT_MEMORY_REF_IS_FAR(ref));
+    ASSERT_TRUE(port_memory_at(ref, format, NULL, memory_table) == ptr);
+
+    // does not fit into the first segment
+    ptr = port_memory_arena_alloc(&arena, 10, NULL, &ref);
+    ASSERT_TRUE(ptr == &segments[1][0]);
+    ASSERT_TRUE(port_memory_at(ref, format, NULL, memory_table) == ptr);
+
+    ASSERT_TRUE(port_memory_arena_alloc(&arena, 7, NULL, &ref) == NULL);
+
+    // block spills into the next segment, base in the previous one cannot be used for near reference
+    port_memory_arena_reset(&arena);
+    ASSERT_TRUE(port_memory_arena_alloc(&arena, 14, NULL, &ref) == &segments[0][0]);
+
+    ptr = port_memory_arena_alloc(&arena, 4, &segments[0][2], &ref);
+    ASSERT_TRUE(ptr == &segments[1][0]);
+    ASSERT_TRUE(PORT_MEMORY_REF_IS_FAR(ref));
+    ASSERT_TRUE(port_memory_at(ref, format, &segments[0][2], memory_table) == ptr);
+
+    // base in the same segment
+    ptr = port_memory_arena_alloc(&arena, 2, &segments[1][0], &ref);
+    ASSERT_TRUE(ptr == &segments[1][4]);
+    ASSERT_EQ(ref, -4, port_memory_ref_t, "%i");
+
+    port_memory_arena_reset(&arena);
+
+    ptr = port_memory_arena_alloc(&arena, 16, NULL, &ref);
+    ASSERT_TRUE(ptr == &segments[0][0]);
+    ASSERT_EQ(ref, 0, port_memory_ref_t, "%i");
+
+    port_memory_arena_fini(&arena);
+}
+
+TEST(port_memory_pool)
+{
+    port_memory_unit_t segment[64];
+    port_const_void_ptr_t memory_table[2] = {NULL, segment};
+    port_memory_ref_format_t format = {.far = {1, 3}, .near = {2}};
+
+    port_memory_pool_t pool;
+    ASSERT_TRUE(port_memory_pool_init(&pool, format, segment, sizeof(segment), 1, 3));
+    ASSERT_EQ(pool.block_stride, 4, size_t, "%zu");
+    ASSERT_EQ(pool.num_blocks, 16, size_t, "%zu");
+
+    port_memory_ref_t refs[16];
+    for (int i = 0; i < 16; i++)
+    {
+        port_void_ptr_t ptr = port_memory_pool_alloc(&pool, &refs[i]);
+        ASSERT_TRUE(ptr == &segment[4 * i]);
+        ASSERT_TRUE(port_memory_at(refs[i], format, NULL, memory_table) == ptr);
+    }
+    ASSERT_TRUE(port_memory_pool_alloc(&pool, NULL) == NULL);
+
+    for (int i = 0; i < 16; i++)
+        port_memory_pool_free(&pool, refs[i]);
+    ASSERT_EQ(pool.num_free_blocks, 16, size_t, "%zu");
+
+    // last freed block is allocated first
+    ASSERT_TRUE(port_memory_pool_alloc(&pool, &refs[0]) == &segment[60]);
+    port_memory_pool_free(&pool, refs[0]);
+
+    port_memory_pool_cache_t cache;
+    port_memory_pool_cache_init(&cache, &pool, 4);
+
+    for (int i = 0; i < 5; i++)
+        ASSERT_TRUE(port_memory_pool_cache_alloc(&cache, &refs[i]) != NULL);
+    ASSERT_EQ(pool.num_free_blocks, 8, size_t, "%zu");
+    ASSERT_EQ(cache.num_free_blocks, 3, size_t, "%zu");
+
+    for (int i = 0; i < 5; i++)
+        port_memory_pool_cache_free(&cache, refs[i]);
+    ASSERT_EQ(pool.num_free_blocks, 12, size_t, "%zu");
+    ASSERT_EQ(cache.num_free_blocks, 4, size_t, "%zu");
+
+    port_memory_pool_cache_flush(&cache);
+    ASSERT_EQ(pool.num_free_blocks, 16, size_t, "%zu");
+    ASSERT_EQ(cache.num_free_blocks, 0, size_t, "%zu");
+
+    for (int i = 0; i < 16; i++)
+        ASSERT_TRUE(port_memory_pool_alloc(&pool, NULL) != NULL);
+    ASSERT_TRUE(port_memory_pool_cache_alloc(&cache, NULL) == NULL);
+}
+
+TEST(port_memory_image)
+{
+    const char *path = "test_memory_image.bin";
+
+    port_memory_table_t *table = port_memory_table_create(4, 1 << 20);
+    ASSERT_TRUE(table != NULL);
+
+    port_memory_unit_t *segment0 = port_memory_table_alloc_segment(table,
+            (port_memory_segment_params_t){.num_bytes = 100 * sizeof(port_memory_unit_t), .numa_node = -1}, NULL);
+    port_memory_unit_t *segment1 = port_memory_table_alloc_segment(table,
+            (port_memory_segment_params_t){.num_bytes = 5000 * sizeof(port_memory_unit_t), .numa_node = -1}, NULL);
+    ASSERT_TRUE((segment0 != NULL) && (segment1 != NULL));
+
+    segment0[10].PORT_MEMORY_UNIT__AS_REF = PORT_MEMORY_REF_FAR(port_memory_ref_t,
+            table->format.far.num_tidx_bits, 1, 4321);
+    segment1[4321].as_uint_single = 0xDEADBEEF;
+
+    ASSERT_TRUE(port_memory_image_write(path, table, 0));
+    port_memory_table_destroy(table);
+
+    ASSERT_TRUE(port_memory_image_load("nonexistent_memory_image.bin", false) == NULL);
+
+    table = port_memory_image_load(path, true);
+    ASSERT_TRUE(table != NULL);
+    ASSERT_EQ(table->num_segments, 2, port_uint32_t, "%u");
+    ASSERT_EQ(table->segments[1].num_bytes, 5000 * sizeof(port_memory_unit_t), size_t, "%zu");
+
+    const port_memory_unit_t *loaded_segment0 = table->pointers[0];
+    const port_memory_unit_t *ptr = port_memory_at(loaded_segment0[10].PORT_MEMORY_UNIT__AS_REF,
+            table->format, NULL, table->pointers);
+    ASSERT_EQ(ptr->as_uint_single, 0xDEADBEEF, port_uint32_t, "%X");
+
+    port_memory_table_destroy(table);
+    remove(path);
+}
+
+TEST(port_memory_profile)
+{
+    port_memory_unit_t units[256] = {0};
+    port_memory_ref_format_t format = {.far = {2, 2}, .near = {2}};
+
+    port_memory_profile_reset();
+
+    port_memory_profile_record(-1, format, &units[1]);
+    port_memory_profile_record(-100, format, &units[100]);
+    port_memory_profile_record(PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 0, 0), format, &units[0]);
+    port_memory_profile_record(PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 3, 8), format, &units[8]);
+    port_memory_profile_record(PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 3, 9), format, &units[9]);
+
+    for (int i = 0; i < 2 * PORT_MEMORY_PROFILE_SAMPLE_PERIOD; i++)
+        port_memory_profile_record(-1, format, &units[1]);
+
+    port_memory_profile_t *profile = malloc(sizeof(*profile));
+    ASSERT_TRUE(profile != NULL);
+
+    port_memory_profile_collect(profile);
+
+    ASSERT_EQ(profile->num_near, 2 + 2 * PORT_MEMORY_PROFILE_SAMPLE_PERIOD, port_uint64_t, "%lu");
+    ASSERT_EQ(profile->num_far, 3, port_uint64_t, "%lu");
+    ASSERT_EQ(profile->tidx_hits[0], 1, port_uint64_t, "%lu");
+    ASSERT_EQ(profile->tidx_hits[3], 2, port_uint64_t, "%lu");
+
+    ASSERT_EQ(profile->far_offset_log2[0], 1, port_uint64_t, "%lu"); // 0
+    ASSERT_EQ(profile->far_offset_log2[6], 2, port_uint64_t, "%lu"); // 32, 36
+    ASSERT_EQ(profile->near_offset_log2[3], 1 + 2 * PORT_MEMORY_PROFILE_SAMPLE_PERIOD, port_uint64_t, "%lu"); // 4
+    ASSERT_EQ(profile->near_offset_log2[9], 1, port_uint64_t, "%lu"); // 400
+
+    ASSERT_GE(profile->num_reuse_samples, 1, port_uint64_t, "%lu");
+    ASSERT_GE(profile->reuse_distance_log2[1], 1, port_uint64_t, "%lu");
+
+    port_memory_profile_reset();
+    port_memory_profile_collect(profile);
+    ASSERT_EQ(profile->num_near + profile->num_far, 0, port_uint64_t, "%lu");
+
+#ifdef PORT_FEATURE_MEMORY_PROFILE
+    // chain: units[0] -> units[4] -> units[8] -> units[12]
+    port_const_void_ptr_t memory_table[1] = {units};
+    units[0 + 1].PORT_MEMORY_UNIT__AS_REF = -4;
+    units[4 + 1].PORT_MEMORY_UNIT__AS_REF = -4;
+    units[8 + 1].PORT_MEMORY_UNIT__AS_REF = -4;
+
+    // every resolution is recorded once, prefetches are not recorded
+    port_memory_ref_t refs[2] = {-1, PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 0, 1)};
+    port_memory_prefetch(refs[0], format, units, memory_table);
+    port_memory_prefetch_batch(refs, 2, format, units, memory_table);
+
+    ASSERT_TRUE(port_memory_follow_chain(PORT_MEMORY_REF_FAR(port_memory_ref_t, 2, 0, 0), format,
+                NULL, memory_table, 1, 3, NULL) == &units[12]);
+    ASSERT_TRUE(port_memory_at_test(-1, units, memory_table) == &units[1]);
+
+    port_memory_profile_collect(profile);
+    ASSERT_EQ(profile->num_near, 3 + 1, port_uint64_t, "%lu");
+    ASSERT_EQ(profile->num_far, 1, port_uint64_t, "%lu");
+
+    port_memory_profile_reset();
+#endif
+
+    free(profile);
+}